@@ -8,4 +8,11 @@
 #define SIA_VERSION_BUILD "0"
 #define SIA_VERSION_NUMBER "0.0.0.0"
 
+// c compiler used by siac --native and its flags for each optimization level
+#define SIA_C_COMPILER "cc"
+#define SIA_C_FLAGS_O0 "-std=c11 -O0"
+#define SIA_C_FLAGS_O1 "-std=c11 -O1"
+#define SIA_C_FLAGS_O2 "-std=c11 -O2"
+#define SIA_C_FLAGS_O3 "-std=c11 -O3 -flto"
+
 #endif//SIA_CONFIG_HPP
@@ -0,0 +1,126 @@
+/**
+ * @file BytecodeFormat.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_COMPILER_BYTECODE_BYTECODE_FORMAT_HPP
+#define SIA_COMPILER_BYTECODE_BYTECODE_FORMAT_HPP
+
+#include <cstdint>
+
+/*
+ * Layout of a bytecode image, all values are in native byte order :
+ *
+ *   BytecodeHeader
+ *   int64_t[constantCount]              constant pool
+ *   BytecodeFunction[functionCount]     function table
+ *   BytecodeInstruction[codeCount]      code of all functions
+ *   uint32_t[operandCount]              argument registers of calls
+ *   strings                             function names, not null terminated
+ *
+ * Section offsets are from start of image and every reference between
+ * sections is an index, so an image can be mapped at any address and
+ * executed straight from the mapping without any fixups.
+ *
+ * Arguments of a call are passed in registers 0 to parameterCount - 1 of
+ * the callee, and instruction i of a function writes register
+ * parameterCount + i. Operands of instructions are register numbers.
+ */
+
+constexpr char BytecodeMagic[4] = {'S', 'I', 'A', 'B'};
+
+// bump this whenever layout of image changes
+constexpr uint32_t BytecodeFormatVersion = 3;
+
+// entryPoint of images without a main function
+constexpr uint32_t NoEntryPoint = 0xffffffff;
+
+/**
+ * @brief operation performed by a bytecode instruction
+ *
+ */
+enum class BytecodeOpcode : uint32_t {
+    // a : constant index
+    LoadConstant    = 0,
+    // a : parameter index
+    LoadParameter   = 1,
+    // a, b : registers
+    Add             = 2,
+    Subtract        = 3,
+    Multiply        = 4,
+    Divide          = 5,
+    // a : register
+    Negate          = 6,
+    // a : function index, b : argument count, c : first operand index
+    Call            = 7,
+    // a : register
+    Return          = 8,
+};
+
+struct BytecodeHeader{
+    char magic[4];
+    uint32_t formatVersion;
+    // SIA_VERSION_NUMBER of compiler that wrote this image, zero padded
+    char compilerVersion[32];
+    // ChecksumBytes of contents of source
+    uint64_t sourceHash;
+    // ChecksumBytes of everything after header
+    uint64_t checksum;
+    uint64_t imageSize;
+    // index of function to start executing from
+    uint32_t entryPoint;
+    uint32_t functionCount;
+    uint32_t constantCount;
+    uint32_t codeCount;
+    uint32_t operandCount;
+    uint32_t reserved;
+    uint64_t constantsOffset;
+    uint64_t functionsOffset;
+    uint64_t codeOffset;
+    uint64_t operandsOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+};
+
+struct BytecodeFunction{
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t parameterCount;
+    // index of first instruction in code section
+    uint32_t codeOffset;
+    uint32_t codeLength;
+    uint32_t reserved;
+};
+
+struct BytecodeInstruction{
+    BytecodeOpcode opcode;
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+};
+
+#endif//SIA_COMPILER_BYTECODE_BYTECODE_FORMAT_HPP
\ No newline at end of file
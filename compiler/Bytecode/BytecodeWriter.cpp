@@ -0,0 +1,247 @@
+/**
+ * @file BytecodeWriter.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "BytecodeWriter.hpp"
+#include "Config.hpp"
+#include <FileSystem/TemporaryFile.hpp>
+#include <Hash/Hash.hpp>
+#include <Loggers/Log.hpp>
+#include <Memory/Arena.hpp>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// round offset up to multiple of 8
+uint64_t Align(uint64_t offset){
+    return (offset + 7) & ~uint64_t(7);
+}
+
+// sections of image being built
+struct ImageBuilder{
+    std::vector<int64_t> constants;
+    std::unordered_map<int64_t, uint32_t> constantIndices;
+    std::vector<BytecodeFunction> functions;
+    std::vector<BytecodeInstruction> code;
+    std::vector<uint32_t> operands;
+    std::string strings;
+
+    // get index of constant in pool, adding it if it's new
+    uint32_t AddConstant(int64_t value){
+        auto it = constantIndices.find(value);
+        if(it != constantIndices.end()) return it->second;
+        uint32_t index = static_cast<uint32_t>(constants.size());
+        constants.push_back(value);
+        constantIndices.emplace(value, index);
+        return index;
+    }
+};
+
+/**
+ * function encoded independently of all others, in memory from the
+ * arena of the worker that encoded it. Constant indices and operand
+ * offsets are local to the function and get fixed when it's merged
+ * into the image, so functions can be encoded in parallel.
+ */
+struct EncodedFunction{
+    BytecodeInstruction* code;
+    uint32_t codeLength;
+    // value of constant loaded by LoadConstant with a == i is constants[i]
+    int64_t* constants;
+    uint32_t* operands;
+    uint32_t operandCount;
+    // index of first CallImported instruction, or -1 if there is none
+    int64_t importedCall;
+};
+
+// encode function on its own
+void EncodeFunction(const Function& function, Arena& arena, EncodedFunction& encodedFunction){
+    encodedFunction.code = arena.AllocateArray<BytecodeInstruction>(function.instructions.size());
+    encodedFunction.codeLength = 0;
+    encodedFunction.constants = arena.AllocateArray<int64_t>(function.instructions.size());
+    // calls are the only users of arguments, so they bound number of operands
+    encodedFunction.operands = arena.AllocateArray<uint32_t>(function.arguments.size());
+    encodedFunction.operandCount = 0;
+    encodedFunction.importedCall = -1;
+    uint32_t constantCount = 0;
+
+    // register of value defined by instruction
+    auto reg = [&](uint value){
+        return function.parameterCount + value;
+    };
+
+    for(const auto& instruction : function.instructions){
+        BytecodeInstruction& encoded = encodedFunction.code[encodedFunction.codeLength++];
+        switch(instruction.opcode){
+            case Opcode::Constant :
+                encoded.opcode = BytecodeOpcode::LoadConstant;
+                encoded.a = constantCount;
+                encodedFunction.constants[constantCount++] = instruction.value;
+                break;
+            case Opcode::Parameter :
+                encoded.opcode = BytecodeOpcode::LoadParameter;
+                encoded.a = static_cast<uint32_t>(instruction.value);
+                break;
+            case Opcode::Add :
+            case Opcode::Subtract :
+            case Opcode::Multiply :
+            case Opcode::Divide :
+                if(instruction.opcode == Opcode::Add) encoded.opcode = BytecodeOpcode::Add;
+                else if(instruction.opcode == Opcode::Subtract) encoded.opcode = BytecodeOpcode::Subtract;
+                else if(instruction.opcode == Opcode::Multiply) encoded.opcode = BytecodeOpcode::Multiply;
+                else encoded.opcode = BytecodeOpcode::Divide;
+                encoded.a = reg(instruction.lhs);
+                encoded.b = reg(instruction.rhs);
+                break;
+            case Opcode::Negate :
+                encoded.opcode = BytecodeOpcode::Negate;
+                encoded.a = reg(instruction.lhs);
+                break;
+            case Opcode::Call :
+                encoded.opcode = BytecodeOpcode::Call;
+                encoded.a = static_cast<uint32_t>(instruction.value);
+                encoded.b = instruction.rhs;
+                encoded.c = encodedFunction.operandCount;
+                for(uint i=0; i<instruction.rhs; i++){
+                    encodedFunction.operands[encodedFunction.operandCount++] = reg(function.arguments[instruction.lhs + i]);
+                }
+                break;
+            case Opcode::CallImported :
+                // reported while merging so errors come out in source order
+                encodedFunction.importedCall = instruction.value;
+                return;
+            case Opcode::Return :
+                encoded.opcode = BytecodeOpcode::Return;
+                encoded.a = reg(instruction.lhs);
+                break;
+        }
+    }
+}
+
+// append encoded function to image, fixing its local indices
+void MergeFunction(const Function& function, const EncodedFunction& encodedFunction, const Interner& interner, ImageBuilder& builder){
+    const std::string& name = interner.GetString(function.name);
+    BytecodeFunction entry = {};
+    entry.nameOffset = static_cast<uint32_t>(builder.strings.size());
+    entry.nameLength = static_cast<uint32_t>(name.size());
+    entry.parameterCount = function.parameterCount;
+    entry.codeOffset = static_cast<uint32_t>(builder.code.size());
+    entry.codeLength = encodedFunction.codeLength;
+    builder.strings += name;
+
+    uint32_t operandBase = static_cast<uint32_t>(builder.operands.size());
+    for(uint32_t i=0; i<encodedFunction.codeLength; i++){
+        BytecodeInstruction instruction = encodedFunction.code[i];
+        if(instruction.opcode == BytecodeOpcode::LoadConstant) instruction.a = builder.AddConstant(encodedFunction.constants[instruction.a]);
+        else if(instruction.opcode == BytecodeOpcode::Call) instruction.c += operandBase;
+        builder.code.push_back(instruction);
+    }
+    builder.operands.insert(builder.operands.end(), encodedFunction.operands, encodedFunction.operands + encodedFunction.operandCount);
+    builder.functions.push_back(entry);
+}
+
+} // namespace
+
+// write bytecode image
+bool WriteBytecodeImage(const char* filename, const Program& program, const Interner& interner, uint64_t sourceHash, ThreadPool& pool){
+    ImageBuilder builder;
+    BytecodeHeader header = {};
+    header.entryPoint = NoEntryPoint;
+
+    // functions are encoded in parallel a batch at a time into arenas of
+    // workers and merged in source order, so image is same for any number
+    // of threads and scratch memory stays bounded
+    std::vector<Arena> arenas(pool.GetThreadCount());
+    size_t batchSize = static_cast<size_t>(pool.GetThreadCount()) * 16;
+    std::vector<EncodedFunction> encodedFunctions(batchSize);
+    for(size_t first=0; first<program.functions.size(); first+=batchSize){
+        size_t count = std::min(batchSize, program.functions.size() - first);
+        pool.Run(count, [&](size_t task, uint worker){
+            EncodeFunction(program.functions[first + task], arenas[worker], encodedFunctions[task]);
+        });
+
+        for(size_t i=0; i<count; i++){
+            const Function& function = program.functions[first + i];
+            const EncodedFunction& encodedFunction = encodedFunctions[i];
+            if(encodedFunction.importedCall >= 0){
+                LOG(ERROR, "%s calls imported function %s, bytecode images can't call imported functions yet",
+                    interner.GetString(function.name).c_str(), interner.GetString(program.imports[encodedFunction.importedCall].name).c_str())
+                return false;
+            }
+            MergeFunction(function, encodedFunction, interner, builder);
+            if(function.parameterCount == 0 && interner.GetString(function.name) == "main") header.entryPoint = static_cast<uint32_t>(first + i);
+        }
+        for(auto& arena : arenas) arena.Reset();
+    }
+
+    memcpy(header.magic, BytecodeMagic, sizeof(BytecodeMagic));
+    header.formatVersion = BytecodeFormatVersion;
+    strncpy(header.compilerVersion, SIA_VERSION_NUMBER, sizeof(header.compilerVersion) - 1);
+    header.sourceHash = sourceHash;
+    header.functionCount = static_cast<uint32_t>(builder.functions.size());
+    header.constantCount = static_cast<uint32_t>(builder.constants.size());
+    header.codeCount = static_cast<uint32_t>(builder.code.size());
+    header.operandCount = static_cast<uint32_t>(builder.operands.size());
+
+    // every section starts 8 byte aligned so it can be used in place
+    header.constantsOffset = Align(sizeof(BytecodeHeader));
+    header.functionsOffset = Align(header.constantsOffset + builder.constants.size() * sizeof(int64_t));
+    header.codeOffset = Align(header.functionsOffset + builder.functions.size() * sizeof(BytecodeFunction));
+    header.operandsOffset = Align(header.codeOffset + builder.code.size() * sizeof(BytecodeInstruction));
+    header.stringsOffset = Align(header.operandsOffset + builder.operands.size() * sizeof(uint32_t));
+    header.stringsSize = builder.strings.size();
+    header.imageSize = header.stringsOffset + header.stringsSize;
+
+    // assemble everything after header in memory so it can be checksummed
+    std::vector<char> body(header.imageSize - sizeof(BytecodeHeader), 0);
+    auto place = [&](uint64_t offset, const void* data, size_t size){
+        if(size) memcpy(body.data() + offset - sizeof(BytecodeHeader), data, size);
+    };
+    place(header.constantsOffset, builder.constants.data(), builder.constants.size() * sizeof(int64_t));
+    place(header.functionsOffset, builder.functions.data(), builder.functions.size() * sizeof(BytecodeFunction));
+    place(header.codeOffset, builder.code.data(), builder.code.size() * sizeof(BytecodeInstruction));
+    place(header.operandsOffset, builder.operands.data(), builder.operands.size() * sizeof(uint32_t));
+    place(header.stringsOffset, builder.strings.data(), builder.strings.size());
+    header.checksum = ChecksumBytes(body.data(), body.size());
+
+    // write uniquely named file next to destination and rename over it
+    TemporaryFile file;
+    bool written = file.Create(filename)
+        && file.Write(&header, sizeof(header))
+        && file.Write(body.data(), body.size())
+        && file.Commit();
+    if(!written){
+        LOG(ERROR, "failed to write bytecode image %s", filename)
+        return false;
+    }
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+/**
+ * @file BytecodeWriter.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_COMPILER_BYTECODE_BYTECODE_WRITER_HPP
+#define SIA_COMPILER_BYTECODE_BYTECODE_WRITER_HPP
+
+#include "BytecodeFormat.hpp"
+#include <IR/IR.hpp>
+#include <Strings/Interner.hpp>
+#include <Threads/ThreadPool.hpp>
+
+/**
+ * @brief write program as a bytecode image that siavm can execute.
+ *        Function named main without parameters becomes entry point.
+ *        Image is written next to destination and renamed over it.
+ *        Functions are encoded in parallel and merged in source order,
+ *        so image doesn't depend on number of threads in pool.
+ *
+ * @param filename name of image file to write
+ * @param program program to write
+ * @param interner interner the program's names are stored in
+ * @param sourceHash ChecksumBytes of contents of source
+ * @param pool pool to encode functions on, interner is only read meanwhile
+ * @return true if image was written
+ */
+bool WriteBytecodeImage(const char* filename, const Program& program, const Interner& interner, uint64_t sourceHash, ThreadPool& pool);
+
+#endif//SIA_COMPILER_BYTECODE_BYTECODE_WRITER_HPP
\ No newline at end of file
@@ -0,0 +1,227 @@
+/**
+ * @file CEmitter.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "CEmitter.hpp"
+#include "Config.hpp"
+#include <IO/ArenaWriter.hpp>
+#include <IO/Format.hpp>
+#include <Memory/Arena.hpp>
+#include <algorithm>
+#include <climits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// helpers every generated file starts with, they give arithmetic the same meaning as in siavm
+const char* const Prelude =
+    "#include <stdint.h>\n"
+    "#include <stdio.h>\n"
+    "#include <stdlib.h>\n"
+    "\n"
+    "static inline int64_t SiaAdd(int64_t a, int64_t b){ return (int64_t)((uint64_t)a + (uint64_t)b); }\n"
+    "static inline int64_t SiaSubtract(int64_t a, int64_t b){ return (int64_t)((uint64_t)a - (uint64_t)b); }\n"
+    "static inline int64_t SiaMultiply(int64_t a, int64_t b){ return (int64_t)((uint64_t)a * (uint64_t)b); }\n"
+    "static inline int64_t SiaNegate(int64_t a){ return (int64_t)(0 - (uint64_t)a); }\n"
+    "static inline int64_t SiaDivide(int64_t a, int64_t b){\n"
+    "    if(b == 0){\n"
+    "        printf(\"[ERROR] : division by zero\\n\");\n"
+    "        exit(-1);\n"
+    "    }\n"
+    "    return b == -1 ? SiaNegate(a) : a / b;\n"
+    "}\n";
+
+// write C name of function
+template<typename Writer>
+void WriteFunctionName(Writer& writer, const Interner& interner, uint name){
+    writer.Write("sia_");
+    writer.Write(interner.GetString(name));
+}
+
+// write C name of parameter
+template<typename Writer>
+void WriteParameterName(Writer& writer, const Interner& interner, uint name){
+    writer.Write("p_");
+    writer.Write(interner.GetString(name));
+}
+
+// write C signature of function
+template<typename Writer>
+void WriteSignature(Writer& writer, const Function& function, const Interner& interner){
+    writer.Write("int64_t ");
+    WriteFunctionName(writer, interner, function.name);
+    writer.Write("(");
+    if(function.parameterCount == 0) writer.Write("void");
+    for(uint i=0; i<function.parameterCount; i++){
+        if(i) writer.Write(", ");
+        writer.Write("int64_t ");
+        WriteParameterName(writer, interner, function.parameters[i]);
+    }
+    writer.Write(")");
+}
+
+// write value defined by instruction as a C expression
+template<typename Writer>
+void WriteValue(Writer& writer, const Function& function, const Interner& interner, uint value){
+    const Instruction& instruction = function.instructions[value];
+    if(instruction.opcode == Opcode::Parameter){
+        WriteParameterName(writer, interner, function.parameters[instruction.value]);
+    }else if(instruction.opcode == Opcode::Constant){
+        // int is at least 32 bits wide, wider constants need INT64_C
+        if(instruction.value == INT64_MIN){
+            writer.Write("INT64_MIN");
+        }else if(instruction.value >= INT_MIN && instruction.value <= INT_MAX){
+            WriteInteger(writer, instruction.value);
+        }else{
+            writer.Write("INT64_C(");
+            WriteInteger(writer, instruction.value);
+            writer.Write(")");
+        }
+    }else{
+        writer.Write("t");
+        WriteInteger(writer, value);
+    }
+}
+
+// write definition of function
+template<typename Writer>
+void WriteFunction(Writer& writer, const Function& function, const Program& program, const Interner& interner){
+    WriteSignature(writer, function, interner);
+    writer.Write("{\n");
+
+    for(uint i=0; i<function.instructions.size(); i++){
+        const Instruction& instruction = function.instructions[i];
+
+        // parameters and constants are used directly where they are needed
+        if(instruction.opcode == Opcode::Parameter || instruction.opcode == Opcode::Constant) continue;
+
+        if(instruction.opcode == Opcode::Return){
+            writer.Write("    return ");
+            WriteValue(writer, function, interner, instruction.lhs);
+            writer.Write(";\n");
+            continue;
+        }
+
+        writer.Write("    const int64_t t");
+        WriteInteger(writer, i);
+        writer.Write(" = ");
+        switch(instruction.opcode){
+            case Opcode::Add :
+            case Opcode::Subtract :
+            case Opcode::Multiply :
+            case Opcode::Divide :
+                if(instruction.opcode == Opcode::Add) writer.Write("SiaAdd(");
+                else if(instruction.opcode == Opcode::Subtract) writer.Write("SiaSubtract(");
+                else if(instruction.opcode == Opcode::Multiply) writer.Write("SiaMultiply(");
+                else writer.Write("SiaDivide(");
+                WriteValue(writer, function, interner, instruction.lhs);
+                writer.Write(", ");
+                WriteValue(writer, function, interner, instruction.rhs);
+                writer.Write(")");
+                break;
+            case Opcode::Negate :
+                writer.Write("SiaNegate(");
+                WriteValue(writer, function, interner, instruction.lhs);
+                writer.Write(")");
+                break;
+            case Opcode::Call :
+            case Opcode::CallImported :
+                if(instruction.opcode == Opcode::Call) WriteFunctionName(writer, interner, program.functions[instruction.value].name);
+                else WriteFunctionName(writer, interner, program.imports[instruction.value].name);
+                writer.Write("(");
+                for(uint j=0; j<instruction.rhs; j++){
+                    if(j) writer.Write(", ");
+                    WriteValue(writer, function, interner, function.arguments[instruction.lhs + j]);
+                }
+                writer.Write(")");
+                break;
+            default:
+                break;
+        }
+        writer.Write(";\n");
+    }
+
+    writer.Write("}\n");
+}
+
+} // namespace
+
+// write program as C
+void EmitC(BufferedWriter& writer, const Program& program, const Interner& interner, const char* sourceName, ThreadPool& pool){
+    writer.Write("/* generated by siac " SIA_VERSION_NUMBER " from ");
+    writer.Write(sourceName);
+    writer.Write(" */\n");
+    writer.Write(Prelude);
+
+    if(!program.imports.empty()) writer.Write("\n/* imported functions */\n");
+    for(const auto& import : program.imports){
+        writer.Write("int64_t ");
+        WriteFunctionName(writer, interner, import.name);
+        writer.Write("(");
+        if(import.parameterCount == 0) writer.Write("void");
+        for(uint i=0; i<import.parameterCount; i++){
+            writer.Write(i ? ", int64_t" : "int64_t");
+        }
+        writer.Write(");\n");
+    }
+
+    // declare everything first so functions can call each other in any order
+    writer.Write("\n/* functions */\n");
+    const Function* entry = nullptr;
+    for(const auto& function : program.functions){
+        WriteSignature(writer, function, interner);
+        writer.Write(";\n");
+        if(function.parameterCount == 0 && interner.GetString(function.name) == "main") entry = &function;
+    }
+
+    // bodies are generated in parallel a batch at a time into arenas of
+    // workers and written in source order, so memory stays bounded and
+    // output is same for any number of threads
+    std::vector<Arena> arenas(pool.GetThreadCount());
+    size_t batchSize = static_cast<size_t>(pool.GetThreadCount()) * 16;
+    std::vector<std::pair<const char*, size_t>> bodies(batchSize);
+    for(size_t first=0; first<program.functions.size(); first+=batchSize){
+        size_t count = std::min(batchSize, program.functions.size() - first);
+        pool.Run(count, [&](size_t task, uint worker){
+            ArenaWriter body(arenas[worker]);
+            body.Write("\n");
+            WriteFunction(body, program.functions[first + task], program, interner);
+            bodies[task] = {body.GetData(), body.GetSize()};
+        });
+        for(size_t i=0; i<count; i++) writer.Write(bodies[i].first, bodies[i].second);
+        for(auto& arena : arenas) arena.Reset();
+    }
+
+    if(entry){
+        writer.Write("\nint main(void){\n");
+        writer.Write("    printf(\"%lld\\n\", (long long)sia_main());\n");
+        writer.Write("    return 0;\n");
+        writer.Write("}\n");
+    }
+}
@@ -0,0 +1,60 @@
+/**
+ * @file CEmitter.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_COMPILER_CODE_GEN_C_EMITTER_HPP
+#define SIA_COMPILER_CODE_GEN_C_EMITTER_HPP
+
+#include <IO/BufferedWriter.hpp>
+#include <IR/IR.hpp>
+#include <Strings/Interner.hpp>
+#include <Threads/ThreadPool.hpp>
+
+/**
+ * @brief write program as a self contained C11 translation unit.
+ *        Sia function f becomes C function sia_f taking and returning
+ *        int64_t, imported functions are declared extern so the C files
+ *        of imported modules can be linked in. If program has a main
+ *        function without parameters a C main that prints its result
+ *        is added. Arithmetic wraps and division by zero stops the
+ *        program, same as siavm.
+ *
+ *        Declarations are streamed straight into writer. Function bodies
+ *        are generated in parallel a batch at a time into per worker
+ *        arenas and streamed into writer in source order, so output
+ *        doesn't depend on number of threads in pool.
+ *
+ * @param writer writer to write C source to
+ * @param program program to write
+ * @param interner interner the program's names are stored in
+ * @param sourceName name of source, only used in a comment
+ * @param pool pool to generate functions on, interner is only read meanwhile
+ */
+void EmitC(BufferedWriter& writer, const Program& program, const Interner& interner, const char* sourceName, ThreadPool& pool);
+
+#endif//SIA_COMPILER_CODE_GEN_C_EMITTER_HPP
\ No newline at end of file
@@ -0,0 +1,47 @@
+/**
+ * @file Diagnostic.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_COMPILER_COMMON_DIAGNOSTIC_HPP
+#define SIA_COMPILER_COMMON_DIAGNOSTIC_HPP
+
+typedef unsigned int uint;
+
+/**
+ * @brief error found in a source.
+ *        Compiler stages collect these instead of logging them
+ *        directly, the driver reports them with line and column.
+ */
+struct Diagnostic{
+    /// byte offset in source where error was found
+    uint offset;
+    /// error message
+    const char* message;
+};
+
+#endif//SIA_COMPILER_COMMON_DIAGNOSTIC_HPP
\ No newline at end of file
@@ -0,0 +1,101 @@
+/**
+ * @file IR.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_COMPILER_IR_IR_HPP
+#define SIA_COMPILER_IR_IR_HPP
+
+#include <Parser/Ast.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief operation performed by an instruction
+ *
+ */
+enum class Opcode : uint {
+    Constant        = 0,
+    Parameter       = 1,
+    Add             = 2,
+    Subtract        = 3,
+    Multiply        = 4,
+    Divide          = 5,
+    Negate          = 6,
+    Call            = 7,
+    CallImported    = 8,
+    Return          = 9,
+};
+
+/**
+ * @brief instruction of a function.
+ *        Every instruction defines exactly one value, named by
+ *        the index of the instruction in its function. Operands
+ *        always refer to instructions before them.
+ */
+struct Instruction{
+    Opcode opcode;
+
+    /// left operand, only operand of Negate and Return, first index in Function::arguments for calls
+    uint lhs = 0;
+
+    /// right operand, number of arguments for calls
+    uint rhs = 0;
+
+    /// value of Constant, index of Parameter, index of callee for calls
+    int64_t value = 0;
+};
+
+/**
+ * @brief function in intermediate representation.
+ *        Instructions are in execution order and the last one is
+ *        always a Return.
+ */
+struct Function{
+    /// interned name of function
+    uint name;
+    /// number of parameters
+    uint parameterCount;
+    /// interned names of parameters
+    std::vector<uint> parameters;
+    std::vector<Instruction> instructions;
+    /// values passed to calls
+    std::vector<uint> arguments;
+};
+
+/**
+ * @brief complete program in intermediate representation
+ *
+ */
+struct Program{
+    /// functions in source order
+    std::vector<Function> functions;
+    /// functions called from imported modules
+    std::vector<ImportedFunction> imports;
+};
+
+#endif//SIA_COMPILER_IR_IR_HPP
\ No newline at end of file
@@ -0,0 +1,128 @@
+/**
+ * @file Lowering.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "Lowering.hpp"
+#include <cstddef>
+
+namespace {
+
+// add instruction to function and get the value it defines
+uint Emit(Function& function, const Instruction& instruction){
+    function.instructions.push_back(instruction);
+    return static_cast<uint>(function.instructions.size() - 1);
+}
+
+// lower expression and get the value it evaluates to.
+// values holds the value of every earlier expression of the function, indexed from first
+uint LowerExpression(const Module& module, uint index, uint first, const std::vector<uint>& values, Function& function, std::vector<Diagnostic>& errors){
+    const Expression& expression = module.expressions[index];
+    Instruction instruction;
+
+    switch(expression.kind){
+        case ExpressionKind::Integer :
+        case ExpressionKind::Boolean :
+            instruction.opcode = Opcode::Constant;
+            instruction.value = expression.value;
+            return Emit(function, instruction);
+
+        case ExpressionKind::Float :
+            errors.push_back(Diagnostic{expression.offset, "floats are not supported yet"});
+            break;
+
+        case ExpressionKind::String :
+            errors.push_back(Diagnostic{expression.offset, "strings are not supported yet"});
+            break;
+
+        case ExpressionKind::Name :
+            instruction.opcode = Opcode::Parameter;
+            instruction.value = expression.symbol;
+            return Emit(function, instruction);
+
+        case ExpressionKind::Call :
+            instruction.opcode = expression.symbolKind == SymbolKind::Imported ? Opcode::CallImported : Opcode::Call;
+            instruction.lhs = static_cast<uint>(function.arguments.size());
+            instruction.rhs = expression.rhs;
+            instruction.value = expression.symbol;
+            for(uint i=0; i<expression.rhs; i++){
+                function.arguments.push_back(values[module.arguments[expression.lhs + i] - first]);
+            }
+            return Emit(function, instruction);
+
+        case ExpressionKind::Negate :
+            instruction.opcode = Opcode::Negate;
+            instruction.lhs = values[expression.lhs - first];
+            return Emit(function, instruction);
+
+        case ExpressionKind::Binary :
+            if(expression.op == TokenType::Plus) instruction.opcode = Opcode::Add;
+            else if(expression.op == TokenType::Minus) instruction.opcode = Opcode::Subtract;
+            else if(expression.op == TokenType::Star) instruction.opcode = Opcode::Multiply;
+            else instruction.opcode = Opcode::Divide;
+            instruction.lhs = values[expression.lhs - first];
+            instruction.rhs = values[expression.rhs - first];
+            return Emit(function, instruction);
+    }
+
+    // keep instruction stream well formed after an error
+    instruction.opcode = Opcode::Constant;
+    return Emit(function, instruction);
+}
+
+} // namespace
+
+// lower module
+bool LowerModule(const Module& module, Program& program, std::vector<Diagnostic>& errors){
+    size_t errorCount = errors.size();
+    program.imports = module.imports;
+
+    std::vector<uint> values;
+    for(const auto& declaration : module.functions){
+        Function function;
+        function.name = declaration.name;
+        function.parameterCount = declaration.parameterCount;
+        function.parameters.assign(module.parameters.begin() + declaration.firstParameter,
+                                   module.parameters.begin() + declaration.firstParameter + declaration.parameterCount);
+
+        // operands come before their users, so walking expressions in
+        // order lowers them without recursing on long left-deep chains
+        values.clear();
+        for(uint i=declaration.firstExpression; i<=declaration.body; i++){
+            values.push_back(LowerExpression(module, i, declaration.firstExpression, values, function, errors));
+        }
+
+        Instruction instruction;
+        instruction.opcode = Opcode::Return;
+        instruction.lhs = values.back();
+        Emit(function, instruction);
+
+        program.functions.push_back(std::move(function));
+    }
+
+    return errors.size() == errorCount;
+}
\ No newline at end of file
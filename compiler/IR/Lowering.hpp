@@ -0,0 +1,48 @@
+/**
+ * @file Lowering.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_COMPILER_IR_LOWERING_HPP
+#define SIA_COMPILER_IR_LOWERING_HPP
+
+#include "IR.hpp"
+#include <Common/Diagnostic.hpp>
+
+/**
+ * @brief lower a resolved module to intermediate representation.
+ *        Every value is a 64 bit integer for now, booleans become
+ *        0 and 1. Float and string literals are reported as errors.
+ *
+ * @param module resolved module
+ * @param program program to add functions to
+ * @param errors vector to add errors to
+ * @return true if no errors were found
+ */
+bool LowerModule(const Module& module, Program& program, std::vector<Diagnostic>& errors);
+
+#endif//SIA_COMPILER_IR_LOWERING_HPP
\ No newline at end of file
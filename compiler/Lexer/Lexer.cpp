@@ -0,0 +1,290 @@
+/**
+ * @file Lexer.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "Lexer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <thread>
+
+static bool IsDigit(char c){
+    return c >= '0' && c <= '9';
+}
+
+static bool IsIdentifierStart(char c){
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+static bool IsIdentifierChar(char c){
+    return IsIdentifierStart(c) || IsDigit(c);
+}
+
+// add a token to result
+static void AddToken(LexResult& result, TokenType type, int value, size_t offset, size_t length){
+    result.tokens.push_back(Token{type, value, static_cast<uint>(offset), static_cast<uint>(length)});
+}
+
+// add an error to result
+static void AddError(LexResult& result, size_t offset, const char* message){
+    result.errors.push_back(Diagnostic{static_cast<uint>(offset), message});
+}
+
+// lex source in given range
+LexResult LexRange(const char* source, size_t begin, size_t end, LexState state){
+    LexResult result;
+    size_t i = begin;
+
+    // a range starting inside a string or comment continues
+    // something that was opened in a previous range
+    result.openIsContinuation = state != LexState::Normal;
+    result.openOffset = static_cast<uint>(begin);
+
+    while(i < end){
+        // skip till end of string
+        if(state == LexState::InString){
+            while(i < end && source[i] != '"'){
+                // skip escaped character
+                if(source[i] == '\\') i++;
+                i++;
+            }
+            if(i >= end) break;
+
+            // include closing quote
+            i++;
+            if(result.openIsContinuation){
+                result.firstTokenIsContinuation = true;
+                result.openIsContinuation = false;
+            }
+            AddToken(result, TokenType::String, 0, result.openOffset, i - result.openOffset);
+            state = LexState::Normal;
+            continue;
+        }
+
+        // skip till end of block comment
+        if(state == LexState::InBlockComment){
+            while(i + 1 < end && !(source[i] == '*' && source[i + 1] == '/')) i++;
+            if(i + 1 >= end){
+                i = end;
+                break;
+            }
+
+            i += 2;
+            result.openIsContinuation = false;
+            state = LexState::Normal;
+            continue;
+        }
+
+        char c = source[i];
+        size_t start = i;
+
+        // skip whitespace
+        if(c == ' ' || c == '\t' || c == '\r' || c == '\n'){
+            i++;
+            continue;
+        }
+
+        // comments or division
+        if(c == '/'){
+            if(i + 1 < end && source[i + 1] == '/'){
+                while(i < end && source[i] != '\n') i++;
+            }else if(i + 1 < end && source[i + 1] == '*'){
+                i += 2;
+                result.openOffset = static_cast<uint>(start);
+                state = LexState::InBlockComment;
+            }else{
+                AddToken(result, TokenType::FrontSlash, 0, start, 1);
+                i++;
+            }
+            continue;
+        }
+
+        // strings
+        if(c == '"'){
+            i++;
+            result.openOffset = static_cast<uint>(start);
+            state = LexState::InString;
+            continue;
+        }
+
+        // integers and floats
+        if(IsDigit(c)){
+            long long value = 0;
+            bool overflow = false;
+            while(i < end && IsDigit(source[i])){
+                value = value * 10 + (source[i] - '0');
+                if(value > INT_MAX){
+                    overflow = true;
+                    value = INT_MAX;
+                }
+                i++;
+            }
+
+            if(i + 1 < end && source[i] == '.' && IsDigit(source[i + 1])){
+                i++;
+                while(i < end && IsDigit(source[i])) i++;
+                AddToken(result, TokenType::Float, 0, start, i - start);
+            }else{
+                if(overflow) AddError(result, start, "integer literal is too large");
+                AddToken(result, TokenType::Integer, static_cast<int>(value), start, i - start);
+            }
+            continue;
+        }
+
+        // identifiers and keywords
+        if(IsIdentifierStart(c)){
+            while(i < end && IsIdentifierChar(source[i])) i++;
+            size_t length = i - start;
+            if(length == 2 && strncmp(source + start, "fn", 2) == 0){
+                AddToken(result, TokenType::Function, 0, start, length);
+            }else if(length == 4 && strncmp(source + start, "true", 4) == 0){
+                AddToken(result, TokenType::Boolean, 1, start, length);
+            }else if(length == 5 && strncmp(source + start, "false", 5) == 0){
+                AddToken(result, TokenType::Boolean, 0, start, length);
+            }else{
+                AddToken(result, TokenType::Identifier, 0, start, length);
+            }
+            continue;
+        }
+
+        // single character tokens
+        switch(c){
+            case '+': AddToken(result, TokenType::Plus, 0, start, 1); break;
+            case '-': AddToken(result, TokenType::Minus, 0, start, 1); break;
+            case '*': AddToken(result, TokenType::Star, 0, start, 1); break;
+            case '\\': AddToken(result, TokenType::BackSlash, 0, start, 1); break;
+            case '(': AddToken(result, TokenType::LeftParen, 0, start, 1); break;
+            case ')': AddToken(result, TokenType::RightParen, 0, start, 1); break;
+            case ',': AddToken(result, TokenType::Comma, 0, start, 1); break;
+            case '=': AddToken(result, TokenType::Equal, 0, start, 1); break;
+            case ';': AddToken(result, TokenType::Semicolon, 0, start, 1); break;
+            default: AddError(result, start, "unknown character"); break;
+        }
+        i++;
+    }
+
+    result.endState = state;
+    return result;
+}
+
+// report strings and comments that were never closed
+static void CloseSource(LexResult& result){
+    if(result.endState == LexState::InString){
+        AddError(result, result.openOffset, "unterminated string");
+    }else if(result.endState == LexState::InBlockComment){
+        AddError(result, result.openOffset, "unterminated block comment");
+    }
+    result.endState = LexState::Normal;
+}
+
+// lex complete source
+LexResult LexSource(const char* source, size_t size){
+    LexResult result = LexRange(source, 0, size, LexState::Normal);
+    CloseSource(result);
+    return result;
+}
+
+// lex complete source using multiple threads
+LexResult LexSourceParallel(const char* source, size_t size, uint threadCount, size_t minChunkSize){
+    size_t chunkCount = std::min<size_t>(threadCount, size / std::max<size_t>(minChunkSize, 1));
+    if(chunkCount < 2) return LexSource(source, size);
+
+    // split source into chunks, each chunk ends just after a newline
+    std::vector<size_t> bounds = {0};
+    size_t nominalSize = size / chunkCount;
+    for(size_t i=1; i<chunkCount; i++){
+        size_t at = std::max(i * nominalSize, bounds.back());
+        const void* newline = memchr(source + at, '\n', size - at);
+        if(!newline) break;
+        size_t bound = static_cast<const char*>(newline) - source + 1;
+        if(bound >= size) break;
+        if(bound > bounds.back()) bounds.push_back(bound);
+    }
+    bounds.push_back(size);
+    chunkCount = bounds.size() - 1;
+
+    // first chunk can only start in normal state, others are lexed
+    // speculatively for every state they could start in
+    std::vector<LexResult> results(chunkCount * LexStateCount);
+    size_t taskCount = 1 + (chunkCount - 1) * LexStateCount;
+    std::atomic<size_t> nextTask(0);
+
+    auto worker = [&](){
+        size_t task;
+        while((task = nextTask.fetch_add(1)) < taskCount){
+            size_t chunk = task == 0 ? 0 : 1 + (task - 1) / LexStateCount;
+            uint state = task == 0 ? 0 : (task - 1) % LexStateCount;
+            results[chunk * LexStateCount + state] = LexRange(source, bounds[chunk], bounds[chunk + 1], static_cast<LexState>(state));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(size_t i=1; i<std::min<size_t>(threadCount, taskCount); i++){
+        threads.emplace_back(worker);
+    }
+    worker();
+    for(auto& thread : threads) thread.join();
+
+    // stitch results by following end state of each chunk into the next one
+    LexResult result;
+    size_t tokenCount = 0;
+    for(size_t chunk=0; chunk<chunkCount; chunk++){
+        tokenCount += results[chunk * LexStateCount].tokens.size();
+    }
+    result.tokens.reserve(tokenCount);
+
+    LexState state = LexState::Normal;
+    uint openOffset = 0;
+    for(size_t chunk=0; chunk<chunkCount; chunk++){
+        LexResult& chosen = results[chunk * LexStateCount + static_cast<uint>(state)];
+
+        // fix string that was opened in an earlier chunk
+        if(chosen.firstTokenIsContinuation){
+            Token& token = chosen.tokens.front();
+            token.length += token.offset - openOffset;
+            token.offset = openOffset;
+        }
+
+        if(!chosen.openIsContinuation) openOffset = chosen.openOffset;
+        state = chosen.endState;
+
+        result.tokens.insert(result.tokens.end(), chosen.tokens.begin(), chosen.tokens.end());
+        result.errors.insert(result.errors.end(), chosen.errors.begin(), chosen.errors.end());
+
+        // release speculative results of this chunk as early as possible
+        for(uint i=0; i<LexStateCount; i++){
+            std::vector<Token>().swap(results[chunk * LexStateCount + i].tokens);
+        }
+    }
+
+    result.endState = state;
+    result.openOffset = openOffset;
+    CloseSource(result);
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+/**
+ * @file Lexer.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef SIA_COMPILER_LEXER_LEXER_HPP
+#define SIA_COMPILER_LEXER_LEXER_HPP
+
+#include "Token.hpp"
+#include <Common/Diagnostic.hpp>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief state of lexer at the start of a line.
+ *        Tokens other than strings and block comments never
+ *        cross a newline, so these are the only states a chunk
+ *        that begins right after a newline can start in.
+ */
+enum class LexState : uint {
+    Normal          = 0,
+    InString        = 1,
+    InBlockComment  = 2,
+};
+
+/// number of values in LexState
+constexpr uint LexStateCount = 3;
+
+/// smallest chunk LexSourceParallel splits source into by default
+constexpr size_t DefaultMinChunkSize = 1 << 20;
+
+/**
+ * @brief tokens and errors produced by lexing a range of source
+ *
+ */
+struct LexResult{
+    std::vector<Token> tokens;
+
+    /**
+     * @brief errors are collected instead of being logged directly
+     *        because speculative lexing produces errors for states
+     *        that may turn out to be wrong.
+     */
+    std::vector<Diagnostic> errors;
+
+    /// state lexer was in when range ended
+    LexState endState = LexState::Normal;
+
+    /// offset where the string or comment left open at end of range started
+    uint openOffset = 0;
+
+    /**
+     * @brief true if the range started inside a string or comment
+     *        and that string or comment never closed in this range.
+     *        openOffset is meaningless in that case and must be
+     *        taken from the range before this one.
+     */
+    bool openIsContinuation = false;
+
+    /**
+     * @brief true if the range started inside a string and the first
+     *        token is the tail of that string. Its offset and length
+     *        must be fixed using the range before this one.
+     */
+    bool firstTokenIsContinuation = false;
+};
+
+/**
+ * @brief lex source in range [begin, end) starting in given state.
+ *        end must either be the end of source or point just past a newline.
+ *
+ * @param source pointer to start of source buffer
+ * @param begin offset to start lexing from
+ * @param end offset to stop lexing at
+ * @param state state lexer is in at begin
+ * @return LexResult
+ */
+LexResult LexRange(const char* source, size_t begin, size_t end, LexState state);
+
+/**
+ * @brief lex complete source on calling thread
+ *
+ * @param source pointer to source buffer
+ * @param size size of source buffer
+ * @return LexResult with endState always Normal
+ */
+LexResult LexSource(const char* source, size_t size);
+
+/**
+ * @brief lex complete source using given number of threads.
+ *        Source is split into chunks at line starts and every chunk
+ *        is lexed once for each LexState it could start in. Results
+ *        are then stitched together by following the end state of
+ *        each chunk into the next one. Output is identical to LexSource.
+ *        Sources smaller than two chunks are lexed on calling thread.
+ *
+ * @param source pointer to source buffer
+ * @param size size of source buffer
+ * @param threadCount maximum number of threads to use
+ * @param minChunkSize smallest chunk to split source into, at least 1
+ * @return LexResult with endState always Normal
+ */
+LexResult LexSourceParallel(const char* source, size_t size, uint threadCount, size_t minChunkSize = DefaultMinChunkSize);
+
+#endif//SIA_COMPILER_LEXER_LEXER_HPP
\ No newline at end of file
@@ -38,6 +38,10 @@
 struct Token{
     TokenType type;
     int value;
+    /// byte offset of first character of token in source
+    uint offset;
+    /// number of bytes token spans in source
+    uint length;
 };
 
 #endif//SIA_COMPILER_LEXER_TOKEN_HPP
\ No newline at end of file
@@ -41,6 +41,13 @@ enum class TokenType : uint {
     Float           = 7,
     Boolean         = 8,
     String          = 9,
+    Identifier      = 10,
+    LeftParen       = 11,
+    RightParen      = 12,
+    Comma           = 13,
+    Equal           = 14,
+    Semicolon       = 15,
+    Function        = 16,
 };
 
 #endif//SIA_COMPILER_LEXER_TOKEN_TYPES_HPP
\ No newline at end of file
@@ -0,0 +1,273 @@
+/**
+ * @file ModuleInterface.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "ModuleInterface.hpp"
+#include "Config.hpp"
+#include <FileSystem/TemporaryFile.hpp>
+#include <Hash/Hash.hpp>
+#include <Loggers/Log.hpp>
+#include <cstring>
+
+namespace {
+
+/*
+ * Layout of an interface file, all values are in native byte order :
+ *
+ *   InterfaceHeader
+ *   InterfaceBucket[bucketCount]    open addressing hash table of exported names
+ *   declarations                    DeclarationRecord followed by parameter types
+ *   strings                         source path and exported names, not null terminated
+ *
+ * Offsets of sections are from start of file, offsets inside a bucket are
+ * from start of their section. Nothing in the file needs fixing up after
+ * it is mapped.
+ */
+
+constexpr char InterfaceMagic[4] = {'S', 'I', 'A', 'I'};
+
+// bump this whenever layout of interface changes
+constexpr uint32_t InterfaceFormatVersion = 3;
+
+struct InterfaceHeader{
+    char magic[4];
+    uint32_t formatVersion;
+    // SIA_VERSION_NUMBER of compiler that wrote this file, zero padded
+    char compilerVersion[32];
+    // ChecksumBytes of contents of source
+    uint64_t sourceHash;
+    // FileStamp of source when it was hashed
+    uint64_t sourceSize;
+    int64_t sourceModifiedTime;
+    uint32_t sourcePathOffset;
+    uint32_t sourcePathLength;
+    // always a power of two
+    uint32_t bucketCount;
+    uint32_t symbolCount;
+    uint64_t bucketsOffset;
+    uint64_t declarationsOffset;
+    uint64_t declarationsSize;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+};
+
+struct InterfaceBucket{
+    // lower 32 bits of HashBytes of name
+    uint32_t hash;
+    uint32_t nameOffset;
+    // zero for empty buckets, names are never empty
+    uint32_t nameLength;
+    uint32_t declarationOffset;
+};
+
+struct DeclarationRecord{
+    uint32_t kind;
+    uint32_t returnType;
+    uint32_t parameterCount;
+};
+
+// hash of name stored in buckets
+uint32_t HashName(const char* name, size_t length){
+    return static_cast<uint32_t>(HashBytes(name, length));
+}
+
+// get header of mapped interface
+const InterfaceHeader& GetHeader(const MappedFile& file){
+    return *reinterpret_cast<const InterfaceHeader*>(file.GetData());
+}
+
+// check that range [offset, offset + size) lies in a section of given size
+bool InRange(uint64_t offset, uint64_t size, uint64_t sectionSize){
+    return offset <= sectionSize && size <= sectionSize - offset;
+}
+
+} // namespace
+
+// map interface and check header
+bool ModuleInterface::Open(const char* filename){
+    this->filename = filename;
+    if(!file.Open(filename)){
+        LOG(ERROR, "failed to open interface %s", filename)
+        return false;
+    }
+
+    if(file.GetSize() < sizeof(InterfaceHeader) || memcmp(file.GetData(), InterfaceMagic, sizeof(InterfaceMagic)) != 0){
+        LOG(ERROR, "%s is not a module interface", filename)
+        file.Close();
+        return false;
+    }
+
+    const InterfaceHeader& header = GetHeader(file);
+    char compilerVersion[sizeof(header.compilerVersion)] = {};
+    strncpy(compilerVersion, SIA_VERSION_NUMBER, sizeof(compilerVersion) - 1);
+    if(header.formatVersion != InterfaceFormatVersion || memcmp(header.compilerVersion, compilerVersion, sizeof(compilerVersion)) != 0){
+        LOG(ERROR, "%s was written by a different version of compiler, it must be rebuilt", filename)
+        file.Close();
+        return false;
+    }
+
+    // make sure all sections lie inside file so that lookups can trust them
+    uint64_t size = file.GetSize();
+    bool valid = header.bucketCount != 0 && (header.bucketCount & (header.bucketCount - 1)) == 0
+        && header.bucketsOffset % alignof(InterfaceBucket) == 0
+        && header.declarationsOffset % alignof(DeclarationRecord) == 0
+        && InRange(header.bucketsOffset, uint64_t(header.bucketCount) * sizeof(InterfaceBucket), size)
+        && InRange(header.declarationsOffset, header.declarationsSize, size)
+        && InRange(header.stringsOffset, header.stringsSize, size)
+        && InRange(header.sourcePathOffset, header.sourcePathLength, header.stringsSize);
+    if(!valid){
+        LOG(ERROR, "%s is corrupt, it must be rebuilt", filename)
+        file.Close();
+        return false;
+    }
+
+    return true;
+}
+
+// get hash of source
+uint64_t ModuleInterface::GetSourceHash() const{
+    return GetHeader(file).sourceHash;
+}
+
+// get path of source
+std::string ModuleInterface::GetSourcePath() const{
+    const InterfaceHeader& header = GetHeader(file);
+    return std::string(file.GetData() + header.stringsOffset + header.sourcePathOffset, header.sourcePathLength);
+}
+
+// check whether source is unchanged
+bool ModuleInterface::IsUpToDate() const{
+    const InterfaceHeader& header = GetHeader(file);
+    std::string sourcePath = GetSourcePath();
+    FileStamp stamp;
+    if(!GetFileStamp(sourcePath.c_str(), stamp)) return false;
+    if(stamp.size != header.sourceSize) return false;
+    if(stamp.modifiedTime == header.sourceModifiedTime) return true;
+
+    // touched but maybe not changed, only contents can tell
+    MappedFile source;
+    if(!source.Open(sourcePath.c_str())) return false;
+    return ChecksumBytes(source.GetData(), source.GetSize()) == GetSourceHash();
+}
+
+// find declaration by name
+bool ModuleInterface::Lookup(const char* name, size_t length, InterfaceDeclaration& declaration) const{
+    const InterfaceHeader& header = GetHeader(file);
+    const InterfaceBucket* buckets = reinterpret_cast<const InterfaceBucket*>(file.GetData() + header.bucketsOffset);
+    const char* strings = file.GetData() + header.stringsOffset;
+    const char* declarations = file.GetData() + header.declarationsOffset;
+
+    uint32_t hash = HashName(name, length);
+    uint32_t mask = header.bucketCount - 1;
+    for(uint32_t probe=0; probe<header.bucketCount; probe++){
+        const InterfaceBucket& bucket = buckets[(hash + probe) & mask];
+        if(bucket.nameLength == 0) return false;
+        if(bucket.hash != hash || bucket.nameLength != length) continue;
+        if(!InRange(bucket.nameOffset, bucket.nameLength, header.stringsSize)) return false;
+        if(memcmp(strings + bucket.nameOffset, name, length) != 0) continue;
+
+        // only now the declaration itself is read
+        if(bucket.declarationOffset % alignof(DeclarationRecord) != 0 || !InRange(bucket.declarationOffset, sizeof(DeclarationRecord), header.declarationsSize)) return false;
+        const DeclarationRecord* record = reinterpret_cast<const DeclarationRecord*>(declarations + bucket.declarationOffset);
+        uint64_t parametersOffset = bucket.declarationOffset + sizeof(DeclarationRecord);
+        if(!InRange(parametersOffset, uint64_t(record->parameterCount) * sizeof(InterfaceType), header.declarationsSize)) return false;
+
+        declaration.kind = static_cast<DeclarationKind>(record->kind);
+        declaration.returnType = static_cast<InterfaceType>(record->returnType);
+        declaration.parameterCount = record->parameterCount;
+        declaration.parameterTypes = reinterpret_cast<const InterfaceType*>(declarations + parametersOffset);
+        return true;
+    }
+    return false;
+}
+
+// write interface of module
+bool WriteModuleInterface(const char* filename, const Module& module, const Interner& interner, const char* sourcePath, uint64_t sourceHash, const FileStamp& sourceStamp){
+    InterfaceHeader header = {};
+    memcpy(header.magic, InterfaceMagic, sizeof(InterfaceMagic));
+    header.formatVersion = InterfaceFormatVersion;
+    strncpy(header.compilerVersion, SIA_VERSION_NUMBER, sizeof(header.compilerVersion) - 1);
+    header.sourceHash = sourceHash;
+    header.sourceSize = sourceStamp.size;
+    header.sourceModifiedTime = sourceStamp.modifiedTime;
+    header.symbolCount = static_cast<uint32_t>(module.functions.size());
+
+    // keep table at most half full so that probes stay short
+    header.bucketCount = 1;
+    while(header.bucketCount < header.symbolCount * 2) header.bucketCount *= 2;
+
+    std::string strings(sourcePath);
+    header.sourcePathOffset = 0;
+    header.sourcePathLength = static_cast<uint32_t>(strings.size());
+
+    std::vector<InterfaceBucket> buckets(header.bucketCount, InterfaceBucket{});
+    std::vector<uint32_t> declarations;
+    uint32_t mask = header.bucketCount - 1;
+    for(const auto& function : module.functions){
+        const std::string& name = interner.GetString(function.name);
+
+        InterfaceBucket bucket;
+        bucket.hash = HashName(name.data(), name.size());
+        bucket.nameOffset = static_cast<uint32_t>(strings.size());
+        bucket.nameLength = static_cast<uint32_t>(name.size());
+        bucket.declarationOffset = static_cast<uint32_t>(declarations.size() * sizeof(uint32_t));
+        strings += name;
+
+        // every value is an integer for now
+        declarations.push_back(static_cast<uint32_t>(DeclarationKind::Function));
+        declarations.push_back(static_cast<uint32_t>(InterfaceType::Integer));
+        declarations.push_back(function.parameterCount);
+        for(uint i=0; i<function.parameterCount; i++){
+            declarations.push_back(static_cast<uint32_t>(InterfaceType::Integer));
+        }
+
+        uint32_t slot = bucket.hash & mask;
+        while(buckets[slot].nameLength != 0) slot = (slot + 1) & mask;
+        buckets[slot] = bucket;
+    }
+
+    header.bucketsOffset = sizeof(InterfaceHeader);
+    header.declarationsOffset = header.bucketsOffset + buckets.size() * sizeof(InterfaceBucket);
+    header.declarationsSize = declarations.size() * sizeof(uint32_t);
+    header.stringsOffset = header.declarationsOffset + header.declarationsSize;
+    header.stringsSize = strings.size();
+
+    // write uniquely named file next to destination and rename over it
+    TemporaryFile file;
+    bool written = file.Create(filename)
+        && file.Write(&header, sizeof(header))
+        && file.Write(buckets.data(), buckets.size() * sizeof(InterfaceBucket))
+        && file.Write(declarations.data(), header.declarationsSize)
+        && file.Write(strings.data(), strings.size())
+        && file.Commit();
+    if(!written){
+        LOG(ERROR, "failed to write interface %s", filename)
+        return false;
+    }
+    return true;
+}
\ No newline at end of file
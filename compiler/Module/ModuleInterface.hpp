@@ -0,0 +1,145 @@
+/**
+ * @file ModuleInterface.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_COMPILER_MODULE_MODULE_INTERFACE_HPP
+#define SIA_COMPILER_MODULE_MODULE_INTERFACE_HPP
+
+#include <FileSystem/FileStamp.hpp>
+#include <FileSystem/MappedFile.hpp>
+#include <Parser/Ast.hpp>
+#include <Strings/Interner.hpp>
+#include <cstdint>
+
+/**
+ * @brief type of a value in an interface
+ *
+ */
+enum class InterfaceType : uint32_t {
+    Integer         = 0,
+};
+
+/**
+ * @brief kind of a declaration in an interface
+ *
+ */
+enum class DeclarationKind : uint32_t {
+    Function        = 0,
+};
+
+/**
+ * @brief declaration read from an interface.
+ *        parameterTypes points into the mapped file and is only
+ *        valid as long as the ModuleInterface it came from.
+ */
+struct InterfaceDeclaration{
+    DeclarationKind kind;
+    InterfaceType returnType;
+    uint parameterCount;
+    const InterfaceType* parameterTypes;
+};
+
+/**
+ * @brief binary interface of a compiled source, loaded lazily.
+ *        The file is memory mapped and only the header is read when
+ *        it is opened. Exported names live in an on-disk hash table
+ *        whose keys point into a string table in the same mapping, so
+ *        a lookup touches one bucket, one name and one declaration.
+ *        Nothing is deserialized for names that are never looked up.
+ *
+ *        An interface is only accepted if it was written by the same
+ *        SIA_VERSION_NUMBER, and is up to date only while the hash of
+ *        the source it was written from doesn't change. Size and
+ *        modification time of source are recorded too, so the source
+ *        is only read and hashed when those differ.
+ */
+class ModuleInterface{
+    // mapped interface file
+    MappedFile file;
+    // name of interface file, for error messages
+    std::string filename;
+public:
+    /**
+     * @brief map interface file and check its header.
+     *        Logs an error if file is not a valid interface or
+     *        was written by a different compiler version.
+     *
+     * @param filename name of interface file
+     * @return true if interface can be used
+     */
+    bool Open(const char* filename);
+
+    /**
+     * @brief check whether source the interface was written from is
+     *        unchanged. If its size and modification time match those
+     *        recorded in the interface it isn't read at all, otherwise
+     *        it must still hash to the hash recorded in the interface.
+     *
+     * @return true if interface is up to date
+     */
+    bool IsUpToDate() const;
+
+    /**
+     * @brief find an exported declaration by name
+     *
+     * @param name pointer to name, need not be null terminated
+     * @param length length of name
+     * @param declaration filled in if name was found
+     * @return true if name was found
+     */
+    bool Lookup(const char* name, size_t length, InterfaceDeclaration& declaration) const;
+
+    /// get hash of source recorded in interface
+    uint64_t GetSourceHash() const;
+
+    /// get path of source recorded in interface
+    std::string GetSourcePath() const;
+
+    /// get name of mapped interface file
+    const std::string& GetFilename() const{
+        return filename;
+    }
+};
+
+/**
+ * @brief write interface of given module.
+ *        File is written next to the destination and renamed over it,
+ *        so other compilers that have the old interface mapped are not
+ *        affected.
+ *
+ * @param filename name of interface file to write
+ * @param module resolved module to export functions of
+ * @param interner interner the module's names are stored in
+ * @param sourcePath path of source the module was compiled from
+ * @param sourceHash ChecksumBytes of contents of source
+ * @param sourceStamp stamp of source, taken before it was read
+ * @return true if interface was written
+ */
+bool WriteModuleInterface(const char* filename, const Module& module, const Interner& interner, const char* sourcePath, uint64_t sourceHash, const FileStamp& sourceStamp);
+
+#endif//SIA_COMPILER_MODULE_MODULE_INTERFACE_HPP
\ No newline at end of file
@@ -0,0 +1,306 @@
+/**
+ * @file Optimizer.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "Optimizer.hpp"
+#include <utility>
+
+namespace {
+
+// check whether instruction can stop the program, such instructions are never removed
+bool MayTrap(const Instruction& instruction){
+    return instruction.opcode == Opcode::Divide || instruction.opcode == Opcode::Call || instruction.opcode == Opcode::CallImported;
+}
+
+// check whether instruction is a call
+bool IsCall(const Instruction& instruction){
+    return instruction.opcode == Opcode::Call || instruction.opcode == Opcode::CallImported;
+}
+
+// number of value operands in lhs and rhs of instruction, calls keep theirs in arguments
+uint OperandCount(const Instruction& instruction){
+    switch(instruction.opcode){
+        case Opcode::Add :
+        case Opcode::Subtract :
+        case Opcode::Multiply :
+        case Opcode::Divide :
+            return 2;
+        case Opcode::Negate :
+        case Opcode::Return :
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// arithmetic wraps around like two's complement integers, same as siavm
+int64_t Wrap(uint64_t value){
+    return static_cast<int64_t>(value);
+}
+
+/**
+ * table of values computed so far in a function, used to find
+ * instructions that compute a value that is already available
+ */
+class ValueTable{
+    // index of value + 1 in every slot, 0 for empty slots
+    uint* slots;
+    size_t mask;
+    const std::vector<Instruction>& instructions;
+    const std::vector<uint>& arguments;
+
+    // hash of what instruction computes
+    uint64_t Hash(const Instruction& instruction) const{
+        uint64_t hash = static_cast<uint64_t>(instruction.opcode) * 0x9e3779b97f4a7c15ull;
+        auto mix = [&](uint64_t value){
+            hash = (hash ^ value) * 0x100000001b3ull;
+        };
+        mix(static_cast<uint64_t>(instruction.value));
+        if(IsCall(instruction)){
+            for(uint i=0; i<instruction.rhs; i++) mix(arguments[instruction.lhs + i]);
+        }else{
+            mix(instruction.lhs);
+            mix(instruction.rhs);
+        }
+        return hash ^ (hash >> 32);
+    }
+
+    // check whether two instructions compute same value
+    bool Equal(const Instruction& a, const Instruction& b) const{
+        if(a.opcode != b.opcode || a.value != b.value || a.rhs != b.rhs) return false;
+        if(!IsCall(a)) return a.lhs == b.lhs;
+        for(uint i=0; i<a.rhs; i++){
+            if(arguments[a.lhs + i] != arguments[b.lhs + i]) return false;
+        }
+        return true;
+    }
+public:
+    ValueTable(Arena& arena, size_t valueCount, const std::vector<Instruction>& instructions, const std::vector<uint>& arguments)
+    : instructions(instructions), arguments(arguments){
+        size_t capacity = 16;
+        while(capacity < valueCount * 2) capacity *= 2;
+        slots = arena.AllocateArray<uint>(capacity);
+        mask = capacity - 1;
+    }
+
+    /**
+     * find value computed the same way as instruction, if there is
+     * none then value is recorded as the one computing it
+     */
+    bool FindOrInsert(const Instruction& instruction, uint value, uint& existing){
+        size_t slot = Hash(instruction) & mask;
+        while(slots[slot]){
+            if(Equal(instructions[slots[slot] - 1], instruction)){
+                existing = slots[slot] - 1;
+                return true;
+            }
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = value + 1;
+        return false;
+    }
+};
+
+// turn instruction into a constant
+void MakeConstant(Instruction& instruction, int64_t value){
+    instruction = Instruction();
+    instruction.opcode = Opcode::Constant;
+    instruction.value = value;
+}
+
+/**
+ * fold constants and simplify arithmetic. Returns true if instruction
+ * computes an existing value, which is stored in alias. Otherwise
+ * instruction may have been rewritten into a simpler one.
+ */
+bool Simplify(Instruction& instruction, const std::vector<Instruction>& values, uint& alias){
+    auto isConstant = [&](uint value, int64_t constant){
+        return values[value].opcode == Opcode::Constant && values[value].value == constant;
+    };
+
+    if(instruction.opcode == Opcode::Negate){
+        const Instruction& operand = values[instruction.lhs];
+        if(operand.opcode == Opcode::Constant){
+            MakeConstant(instruction, Wrap(0 - uint64_t(operand.value)));
+        }else if(operand.opcode == Opcode::Negate){
+            alias = operand.lhs;
+            return true;
+        }
+        return false;
+    }
+
+    if(OperandCount(instruction) != 2) return false;
+
+    // order operands of commutative operations so that equal expressions look equal
+    if((instruction.opcode == Opcode::Add || instruction.opcode == Opcode::Multiply) && instruction.lhs > instruction.rhs){
+        std::swap(instruction.lhs, instruction.rhs);
+    }
+
+    const Instruction& lhs = values[instruction.lhs];
+    const Instruction& rhs = values[instruction.rhs];
+    if(lhs.opcode == Opcode::Constant && rhs.opcode == Opcode::Constant){
+        uint64_t a = uint64_t(lhs.value);
+        uint64_t b = uint64_t(rhs.value);
+        switch(instruction.opcode){
+            case Opcode::Add : MakeConstant(instruction, Wrap(a + b)); return false;
+            case Opcode::Subtract : MakeConstant(instruction, Wrap(a - b)); return false;
+            case Opcode::Multiply : MakeConstant(instruction, Wrap(a * b)); return false;
+            case Opcode::Divide :
+                // division by zero is left for runtime to report
+                if(rhs.value == 0) return false;
+                MakeConstant(instruction, rhs.value == -1 ? Wrap(0 - a) : lhs.value / rhs.value);
+                return false;
+            default:
+                return false;
+        }
+    }
+
+    switch(instruction.opcode){
+        case Opcode::Add :
+            if(isConstant(instruction.lhs, 0)){ alias = instruction.rhs; return true; }
+            if(isConstant(instruction.rhs, 0)){ alias = instruction.lhs; return true; }
+            break;
+        case Opcode::Subtract :
+            if(isConstant(instruction.rhs, 0)){ alias = instruction.lhs; return true; }
+            if(instruction.lhs == instruction.rhs) MakeConstant(instruction, 0);
+            break;
+        case Opcode::Multiply :
+            if(isConstant(instruction.lhs, 1)){ alias = instruction.rhs; return true; }
+            if(isConstant(instruction.rhs, 1)){ alias = instruction.lhs; return true; }
+            // operand is still computed if it can trap, since those are never removed
+            if(isConstant(instruction.lhs, 0) || isConstant(instruction.rhs, 0)) MakeConstant(instruction, 0);
+            break;
+        case Opcode::Divide :
+            if(isConstant(instruction.rhs, 1)){ alias = instruction.lhs; return true; }
+            break;
+        default:
+            break;
+    }
+    return false;
+}
+
+// remove values that are never used and can't trap
+void RemoveUnused(Function& function, Arena& arena){
+    std::vector<Instruction>& instructions = function.instructions;
+    size_t count = instructions.size();
+
+    // walk backwards so that every use is seen before the value it uses
+    bool* live = arena.AllocateArray<bool>(count);
+    for(size_t i=count; i-- > 0;){
+        const Instruction& instruction = instructions[i];
+        if(instruction.opcode == Opcode::Return || MayTrap(instruction)) live[i] = true;
+        if(!live[i]) continue;
+        if(OperandCount(instruction) >= 1) live[instruction.lhs] = true;
+        if(OperandCount(instruction) == 2) live[instruction.rhs] = true;
+        if(IsCall(instruction)){
+            for(uint j=0; j<instruction.rhs; j++) live[function.arguments[instruction.lhs + j]] = true;
+        }
+    }
+
+    // compact live values and renumber operands
+    uint* renumber = arena.AllocateArray<uint>(count);
+    std::vector<Instruction> kept;
+    std::vector<uint> arguments;
+    kept.reserve(count);
+    for(size_t i=0; i<count; i++){
+        if(!live[i]) continue;
+        Instruction instruction = instructions[i];
+        if(OperandCount(instruction) >= 1) instruction.lhs = renumber[instruction.lhs];
+        if(OperandCount(instruction) == 2) instruction.rhs = renumber[instruction.rhs];
+        if(IsCall(instruction)){
+            uint first = static_cast<uint>(arguments.size());
+            for(uint j=0; j<instruction.rhs; j++) arguments.push_back(renumber[function.arguments[instruction.lhs + j]]);
+            instruction.lhs = first;
+        }
+        renumber[i] = static_cast<uint>(kept.size());
+        kept.push_back(instruction);
+    }
+
+    instructions = std::move(kept);
+    function.arguments = std::move(arguments);
+}
+
+} // namespace
+
+// optimize single function
+void OptimizeFunction(Function& function, int level, Arena& arena){
+    if(level <= 0) return;
+
+    size_t count = function.instructions.size();
+    // value every original instruction was replaced with
+    uint* replacement = arena.AllocateArray<uint>(count);
+
+    std::vector<Instruction> values;
+    std::vector<uint> arguments;
+    values.reserve(count);
+    arguments.reserve(function.arguments.size());
+    ValueTable table(arena, count, values, arguments);
+
+    for(size_t i=0; i<count; i++){
+        Instruction instruction = function.instructions[i];
+        if(OperandCount(instruction) >= 1) instruction.lhs = replacement[instruction.lhs];
+        if(OperandCount(instruction) == 2) instruction.rhs = replacement[instruction.rhs];
+        size_t firstArgument = arguments.size();
+        if(IsCall(instruction)){
+            for(uint j=0; j<instruction.rhs; j++) arguments.push_back(replacement[function.arguments[instruction.lhs + j]]);
+            instruction.lhs = static_cast<uint>(firstArgument);
+        }
+
+        uint existing;
+        if(Simplify(instruction, values, existing)){
+            replacement[i] = existing;
+            continue;
+        }
+
+        // functions have no side effects, so equal calls return equal values too
+        uint value = static_cast<uint>(values.size());
+        if(level >= 2 && instruction.opcode != Opcode::Return && table.FindOrInsert(instruction, value, existing)){
+            arguments.resize(firstArgument);
+            replacement[i] = existing;
+            continue;
+        }
+
+        values.push_back(instruction);
+        replacement[i] = value;
+    }
+
+    function.instructions = std::move(values);
+    function.arguments = std::move(arguments);
+    RemoveUnused(function, arena);
+}
+
+// optimize all functions
+void OptimizeProgram(Program& program, int level, ThreadPool& pool){
+    if(level <= 0) return;
+
+    std::vector<Arena> arenas(pool.GetThreadCount());
+    pool.Run(program.functions.size(), [&](size_t task, uint worker){
+        OptimizeFunction(program.functions[task], level, arenas[worker]);
+        arenas[worker].Reset();
+    });
+}
\ No newline at end of file
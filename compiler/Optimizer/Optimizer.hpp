@@ -0,0 +1,62 @@
+/**
+ * @file Optimizer.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_COMPILER_OPTIMIZER_OPTIMIZER_HPP
+#define SIA_COMPILER_OPTIMIZER_OPTIMIZER_HPP
+
+#include <IR/IR.hpp>
+#include <Memory/Arena.hpp>
+#include <Threads/ThreadPool.hpp>
+
+/**
+ * @brief optimize a single function.
+ *        Level 0 does nothing, level 1 folds constants, simplifies
+ *        arithmetic and removes unused values, level 2 and above also
+ *        reuse values that were already computed. Only the function
+ *        itself is read or written, so different functions can be
+ *        optimized at the same time.
+ *
+ * @param function function to optimize
+ * @param level optimization level
+ * @param arena scratch memory, it is not reset
+ */
+void OptimizeFunction(Function& function, int level, Arena& arena);
+
+/**
+ * @brief optimize every function of program on thread pool.
+ *        Every worker uses its own arena and functions don't depend on
+ *        each other, so result is the same for any number of threads.
+ *
+ * @param program program to optimize
+ * @param level optimization level
+ * @param pool pool to run on
+ */
+void OptimizeProgram(Program& program, int level, ThreadPool& pool);
+
+#endif//SIA_COMPILER_OPTIMIZER_OPTIMIZER_HPP
\ No newline at end of file
@@ -0,0 +1,153 @@
+/**
+ * @file Ast.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_COMPILER_PARSER_AST_HPP
+#define SIA_COMPILER_PARSER_AST_HPP
+
+#include <Lexer/TokenTypes.hpp>
+#include <vector>
+
+/**
+ * @brief kind of expression node
+ *
+ */
+enum class ExpressionKind : uint {
+    Integer         = 0,
+    Float           = 1,
+    Boolean         = 2,
+    String          = 3,
+    Name            = 4,
+    Call            = 5,
+    Negate          = 6,
+    Binary          = 7,
+};
+
+/**
+ * @brief what a name refers to, filled in by resolver
+ *
+ */
+enum class SymbolKind : uint {
+    Unresolved      = 0,
+    Parameter       = 1,
+    Function        = 2,
+    Imported        = 3,
+};
+
+/**
+ * @brief expression node.
+ *        Nodes refer to each other by their index in Module::expressions.
+ */
+struct Expression{
+    ExpressionKind kind;
+
+    /// operator token of Binary expression
+    TokenType op = TokenType::Plus;
+
+    /// value of Integer and Boolean literals
+    int value = 0;
+
+    /// interned name of Name and Call expressions
+    uint name = 0;
+
+    /// operands of Negate and Binary, first index in Module::arguments for Call
+    uint lhs = 0;
+
+    /// right operand of Binary, number of arguments for Call
+    uint rhs = 0;
+
+    /// offset of first character of expression in source
+    uint offset = 0;
+
+    /// what name refers to, set by resolver
+    SymbolKind symbolKind = SymbolKind::Unresolved;
+
+    /**
+     * @brief index of parameter in its function, index of function in
+     *        Module::functions or index of import in Module::imports
+     *        depending on symbolKind
+     */
+    uint symbol = 0;
+};
+
+/**
+ * @brief function declaration : fn name(a, b) = expression;
+ *
+ */
+struct FunctionDeclaration{
+    /// interned name of function
+    uint name;
+    /// first index in Module::parameters
+    uint firstParameter;
+    /// number of parameters
+    uint parameterCount;
+    /**
+     * @brief expressions of function are [firstExpression, body] in
+     *        Module::expressions. Operands always come before the
+     *        expression using them and body is the last one.
+     */
+    uint firstExpression;
+    /// index of body expression in Module::expressions
+    uint body;
+    /// offset of function in source
+    uint offset;
+};
+
+/**
+ * @brief function declared in an imported module interface
+ *
+ */
+struct ImportedFunction{
+    /// interned name of function
+    uint name;
+    /// number of parameters
+    uint parameterCount;
+};
+
+/**
+ * @brief everything parsed from a single source.
+ *        All nodes are kept in flat arrays instead of
+ *        being allocated one by one.
+ */
+struct Module{
+    std::vector<FunctionDeclaration> functions;
+
+    /// interned parameter names of all functions
+    std::vector<uint> parameters;
+
+    /// expression nodes of all functions
+    std::vector<Expression> expressions;
+
+    /// expression indices of call arguments
+    std::vector<uint> arguments;
+
+    /// imported functions used by this module, filled in by resolver
+    std::vector<ImportedFunction> imports;
+};
+
+#endif//SIA_COMPILER_PARSER_AST_HPP
\ No newline at end of file
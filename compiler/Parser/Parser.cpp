@@ -0,0 +1,278 @@
+/**
+ * @file Parser.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "Parser.hpp"
+
+namespace {
+
+// expressions nested deeper than this are rejected instead of overflowing the stack
+constexpr uint MaxNestingDepth = 256;
+
+// recursive descent parser for a single source
+class Parser{
+    const char* source;
+    const std::vector<Token>& tokens;
+    Interner& interner;
+    Module& module;
+    std::vector<Diagnostic>& errors;
+
+    // index of current token
+    size_t current = 0;
+
+    // number of unary expressions currently being parsed, every nested expression goes through one
+    uint depth = 0;
+
+    // check whether all tokens have been consumed
+    bool AtEnd() const{
+        return current >= tokens.size();
+    }
+
+    // check type of current token
+    bool Check(TokenType type) const{
+        return !AtEnd() && tokens[current].type == type;
+    }
+
+    // consume current token if it has given type
+    bool Match(TokenType type){
+        if(!Check(type)) return false;
+        current++;
+        return true;
+    }
+
+    // offset to report errors at, end of source if all tokens were consumed
+    uint ErrorOffset() const{
+        if(!AtEnd()) return tokens[current].offset;
+        if(tokens.empty()) return 0;
+        return tokens.back().offset + tokens.back().length;
+    }
+
+    // consume token of given type or report error
+    bool Expect(TokenType type, const char* message){
+        if(Match(type)) return true;
+        errors.push_back(Diagnostic{ErrorOffset(), message});
+        return false;
+    }
+
+    // intern name of given token
+    uint InternToken(const Token& token){
+        return interner.Intern(source + token.offset, token.length);
+    }
+
+    // add expression node and get its index
+    uint AddExpression(const Expression& expression){
+        module.expressions.push_back(expression);
+        return static_cast<uint>(module.expressions.size() - 1);
+    }
+
+    bool ParsePrimary(uint& index);
+    bool ParseUnary(uint& index);
+    bool ParseTerm(uint& index);
+    bool ParseExpression(uint& index);
+    bool ParseFunction();
+public:
+    Parser(const char* source, const std::vector<Token>& tokens, Interner& interner, Module& module, std::vector<Diagnostic>& errors)
+    : source(source), tokens(tokens), interner(interner), module(module), errors(errors){}
+
+    bool Parse();
+};
+
+// primary := literal | name | call | '(' expression ')'
+bool Parser::ParsePrimary(uint& index){
+    if(AtEnd()){
+        errors.push_back(Diagnostic{ErrorOffset(), "expected expression"});
+        return false;
+    }
+
+    const Token& token = tokens[current];
+    Expression expression;
+    expression.offset = token.offset;
+
+    switch(token.type){
+        case TokenType::Integer:
+        case TokenType::Float:
+        case TokenType::Boolean:
+        case TokenType::String:
+            current++;
+            if(token.type == TokenType::Integer) expression.kind = ExpressionKind::Integer;
+            else if(token.type == TokenType::Float) expression.kind = ExpressionKind::Float;
+            else if(token.type == TokenType::Boolean) expression.kind = ExpressionKind::Boolean;
+            else expression.kind = ExpressionKind::String;
+            expression.value = token.value;
+            index = AddExpression(expression);
+            return true;
+
+        case TokenType::Identifier:
+            current++;
+            expression.name = InternToken(token);
+            if(!Match(TokenType::LeftParen)){
+                expression.kind = ExpressionKind::Name;
+                index = AddExpression(expression);
+                return true;
+            }else{
+                // arguments are parsed first so that they are contiguous in Module::arguments
+                std::vector<uint> arguments;
+                if(!Check(TokenType::RightParen)){
+                    do{
+                        uint argument;
+                        if(!ParseExpression(argument)) return false;
+                        arguments.push_back(argument);
+                    }while(Match(TokenType::Comma));
+                }
+                if(!Expect(TokenType::RightParen, "expected ')' after call arguments")) return false;
+
+                expression.kind = ExpressionKind::Call;
+                expression.lhs = static_cast<uint>(module.arguments.size());
+                expression.rhs = static_cast<uint>(arguments.size());
+                module.arguments.insert(module.arguments.end(), arguments.begin(), arguments.end());
+                index = AddExpression(expression);
+                return true;
+            }
+
+        case TokenType::LeftParen:
+            current++;
+            if(!ParseExpression(index)) return false;
+            return Expect(TokenType::RightParen, "expected ')' after expression");
+
+        default:
+            errors.push_back(Diagnostic{token.offset, "expected expression"});
+            return false;
+    }
+}
+
+// unary := '-' unary | primary
+bool Parser::ParseUnary(uint& index){
+    if(depth == MaxNestingDepth){
+        errors.push_back(Diagnostic{ErrorOffset(), "expression is nested too deeply"});
+        return false;
+    }
+    depth++;
+
+    bool success;
+    if(Check(TokenType::Minus)){
+        Expression expression;
+        expression.kind = ExpressionKind::Negate;
+        expression.offset = tokens[current].offset;
+        current++;
+        success = ParseUnary(expression.lhs);
+        if(success) index = AddExpression(expression);
+    }else{
+        success = ParsePrimary(index);
+    }
+
+    depth--;
+    return success;
+}
+
+// term := unary (('*' | '/') unary)*
+bool Parser::ParseTerm(uint& index){
+    if(!ParseUnary(index)) return false;
+    while(Check(TokenType::Star) || Check(TokenType::FrontSlash)){
+        Expression expression;
+        expression.kind = ExpressionKind::Binary;
+        expression.op = tokens[current].type;
+        expression.offset = module.expressions[index].offset;
+        expression.lhs = index;
+        current++;
+        if(!ParseUnary(expression.rhs)) return false;
+        index = AddExpression(expression);
+    }
+    return true;
+}
+
+// expression := term (('+' | '-') term)*
+bool Parser::ParseExpression(uint& index){
+    if(!ParseTerm(index)) return false;
+    while(Check(TokenType::Plus) || Check(TokenType::Minus)){
+        Expression expression;
+        expression.kind = ExpressionKind::Binary;
+        expression.op = tokens[current].type;
+        expression.offset = module.expressions[index].offset;
+        expression.lhs = index;
+        current++;
+        if(!ParseTerm(expression.rhs)) return false;
+        index = AddExpression(expression);
+    }
+    return true;
+}
+
+// function := 'fn' name '(' [name (',' name)*] ')' '=' expression ';'
+bool Parser::ParseFunction(){
+    FunctionDeclaration function;
+    function.offset = ErrorOffset();
+    if(!Expect(TokenType::Function, "expected 'fn'")) return false;
+
+    if(!Check(TokenType::Identifier)){
+        errors.push_back(Diagnostic{ErrorOffset(), "expected function name"});
+        return false;
+    }
+    function.name = InternToken(tokens[current++]);
+
+    if(!Expect(TokenType::LeftParen, "expected '(' after function name")) return false;
+    function.firstParameter = static_cast<uint>(module.parameters.size());
+    if(!Check(TokenType::RightParen)){
+        do{
+            if(!Check(TokenType::Identifier)){
+                errors.push_back(Diagnostic{ErrorOffset(), "expected parameter name"});
+                return false;
+            }
+            module.parameters.push_back(InternToken(tokens[current++]));
+        }while(Match(TokenType::Comma));
+    }
+    function.parameterCount = static_cast<uint>(module.parameters.size()) - function.firstParameter;
+    if(!Expect(TokenType::RightParen, "expected ')' after parameters")) return false;
+
+    if(!Expect(TokenType::Equal, "expected '=' before function body")) return false;
+    function.firstExpression = static_cast<uint>(module.expressions.size());
+    if(!ParseExpression(function.body)) return false;
+    if(!Expect(TokenType::Semicolon, "expected ';' after function body")) return false;
+
+    module.functions.push_back(function);
+    return true;
+}
+
+// parse all functions
+bool Parser::Parse(){
+    bool success = true;
+    while(!AtEnd()){
+        if(!ParseFunction()){
+            success = false;
+            // skip rest of broken function and continue from next one
+            while(!AtEnd() && !Check(TokenType::Function)) current++;
+        }
+    }
+    return success;
+}
+
+} // namespace
+
+// parse tokens into module
+bool ParseModule(const char* source, const std::vector<Token>& tokens, Interner& interner, Module& module, std::vector<Diagnostic>& errors){
+    Parser parser(source, tokens, interner, module, errors);
+    return parser.Parse();
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+/**
+ * @file Parser.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_COMPILER_PARSER_PARSER_HPP
+#define SIA_COMPILER_PARSER_PARSER_HPP
+
+#include "Ast.hpp"
+#include <Common/Diagnostic.hpp>
+#include <Lexer/Token.hpp>
+#include <Strings/Interner.hpp>
+
+/**
+ * @brief parse tokens of a source into a module.
+ *        Grammar of a source is :
+ *
+ *        module     := function*
+ *        function   := 'fn' name '(' [name (',' name)*] ')' '=' expression ';'
+ *        expression := term (('+' | '-') term)*
+ *        term       := unary (('*' | '/') unary)*
+ *        unary      := '-' unary | primary
+ *        primary    := literal | name | name '(' [expression (',' expression)*] ')'
+ *                    | '(' expression ')'
+ *
+ *        Parentheses, calls and negations may be nested at most 256
+ *        deep, deeper expressions are reported as errors.
+ *
+ * @param source source the tokens were lexed from
+ * @param tokens tokens to parse
+ * @param interner interner to store names in
+ * @param module module to add parsed functions to
+ * @param errors vector to add errors to
+ * @return true if no errors were found
+ */
+bool ParseModule(const char* source, const std::vector<Token>& tokens, Interner& interner, Module& module, std::vector<Diagnostic>& errors);
+
+#endif//SIA_COMPILER_PARSER_PARSER_HPP
\ No newline at end of file
@@ -0,0 +1,161 @@
+/**
+ * @file Resolver.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "Resolver.hpp"
+#include "SymbolTable.hpp"
+
+namespace {
+
+// resolves names of a single module
+class Resolver{
+    Module& module;
+    const Interner& interner;
+    const std::vector<ModuleInterface>& imports;
+    std::vector<Diagnostic>& errors;
+
+    // functions of module in outermost scope, parameters in scope of their function
+    SymbolTable symbols;
+    // imported names looked up so far
+    SymbolTable importedFunctions;
+
+    bool FindImport(uint name, uint& index);
+    void ResolveExpression(uint index);
+public:
+    Resolver(Module& module, const Interner& interner, const std::vector<ModuleInterface>& imports, std::vector<Diagnostic>& errors)
+    : module(module), interner(interner), imports(imports), errors(errors){}
+
+    bool Resolve();
+};
+
+// find function in imported interfaces
+bool Resolver::FindImport(uint name, uint& index){
+    const Symbol* symbol = importedFunctions.Lookup(name);
+    if(symbol){
+        index = symbol->index;
+        return true;
+    }
+
+    const std::string& string = interner.GetString(name);
+    for(const auto& import : imports){
+        InterfaceDeclaration declaration;
+        if(import.Lookup(string.data(), string.size(), declaration) && declaration.kind == DeclarationKind::Function){
+            index = static_cast<uint>(module.imports.size());
+            module.imports.push_back(ImportedFunction{name, declaration.parameterCount});
+            importedFunctions.Declare(name, Symbol{SymbolKind::Imported, index});
+            return true;
+        }
+    }
+    return false;
+}
+
+// resolve names in expression, its operands are resolved separately
+void Resolver::ResolveExpression(uint index){
+    Expression& expression = module.expressions[index];
+    switch(expression.kind){
+        case ExpressionKind::Name :{
+            const Symbol* symbol = symbols.Lookup(expression.name);
+            uint import;
+            if(symbol && symbol->kind == SymbolKind::Parameter){
+                expression.symbolKind = SymbolKind::Parameter;
+                expression.symbol = symbol->index;
+            }else if(symbol || FindImport(expression.name, import)){
+                errors.push_back(Diagnostic{expression.offset, "function can only be called"});
+            }else{
+                errors.push_back(Diagnostic{expression.offset, "unknown name"});
+            }
+            break;
+        }
+
+        case ExpressionKind::Call :{
+            const Symbol* symbol = symbols.Lookup(expression.name);
+            uint parameterCount = 0;
+            uint import;
+            if(symbol && symbol->kind == SymbolKind::Parameter){
+                errors.push_back(Diagnostic{expression.offset, "parameter can't be called"});
+                break;
+            }else if(symbol){
+                expression.symbolKind = SymbolKind::Function;
+                expression.symbol = symbol->index;
+                parameterCount = module.functions[symbol->index].parameterCount;
+            }else if(FindImport(expression.name, import)){
+                expression.symbolKind = SymbolKind::Imported;
+                expression.symbol = import;
+                parameterCount = module.imports[import].parameterCount;
+            }else{
+                errors.push_back(Diagnostic{expression.offset, "unknown function"});
+                break;
+            }
+
+            if(parameterCount != expression.rhs){
+                errors.push_back(Diagnostic{expression.offset, "wrong number of arguments in call"});
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+// resolve all functions
+bool Resolver::Resolve(){
+    size_t errorCount = errors.size();
+
+    for(uint i=0; i<module.functions.size(); i++){
+        const FunctionDeclaration& function = module.functions[i];
+        if(!symbols.Declare(function.name, Symbol{SymbolKind::Function, i})){
+            errors.push_back(Diagnostic{function.offset, "function is already defined"});
+        }
+    }
+
+    for(const auto& function : module.functions){
+        symbols.EnterScope();
+        for(uint i=0; i<function.parameterCount; i++){
+            if(!symbols.Declare(module.parameters[function.firstParameter + i], Symbol{SymbolKind::Parameter, i})){
+                errors.push_back(Diagnostic{function.offset, "parameter is already defined"});
+            }
+        }
+        // walk flat expressions instead of recursing into operands,
+        // long chains like a + b + c + ... would overflow the stack
+        for(uint i=function.firstExpression; i<=function.body; i++){
+            ResolveExpression(i);
+        }
+        symbols.LeaveScope();
+    }
+
+    return errors.size() == errorCount;
+}
+
+} // namespace
+
+// resolve names in module
+bool ResolveModule(Module& module, const Interner& interner, const std::vector<ModuleInterface>& imports, std::vector<Diagnostic>& errors){
+    Resolver resolver(module, interner, imports, errors);
+    return resolver.Resolve();
+}
\ No newline at end of file
@@ -0,0 +1,250 @@
+/**
+ * @file SymbolTable.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "SymbolTable.hpp"
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// number of slots probed at once, table capacity is always a multiple of this
+constexpr size_t GroupSize = 16;
+
+// metadata of slots that are not full, full slots store 7 bits of hash (0 to 127)
+constexpr int8_t Empty = -128;
+constexpr int8_t Deleted = -2;
+
+// hash of interned name, ids are small and dense so they need mixing
+uint64_t HashName(uint name){
+    uint64_t hash = (uint64_t(name) + 1) * 0x9e3779b97f4a7c15ull;
+    return hash ^ (hash >> 32);
+}
+
+// part of hash used to pick first group
+size_t H1(uint64_t hash){
+    return static_cast<size_t>(hash >> 7);
+}
+
+// part of hash stored in metadata byte
+int8_t H2(uint64_t hash){
+    return static_cast<int8_t>(hash & 0x7f);
+}
+
+// metadata bytes of one group of slots
+class Group{
+#ifdef __SSE2__
+    __m128i bytes;
+public:
+    explicit Group(const int8_t* control)
+    : bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))){}
+
+    // bit mask of slots whose metadata equals given byte
+    uint32_t Match(int8_t byte) const{
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(byte), bytes)));
+    }
+
+    // bit mask of slots that are empty or deleted, only those have sign bit set
+    uint32_t MatchFree() const{
+        return static_cast<uint32_t>(_mm_movemask_epi8(bytes));
+    }
+#else
+    const int8_t* bytes;
+public:
+    explicit Group(const int8_t* control)
+    : bytes(control){}
+
+    // bit mask of slots whose metadata equals given byte
+    uint32_t Match(int8_t byte) const{
+        uint32_t mask = 0;
+        for(size_t i=0; i<GroupSize; i++){
+            if(bytes[i] == byte) mask |= 1u << i;
+        }
+        return mask;
+    }
+
+    // bit mask of slots that are empty or deleted, only those have sign bit set
+    uint32_t MatchFree() const{
+        uint32_t mask = 0;
+        for(size_t i=0; i<GroupSize; i++){
+            if(bytes[i] < 0) mask |= 1u << i;
+        }
+        return mask;
+    }
+#endif
+
+    // bit mask of slots that are empty
+    uint32_t MatchEmpty() const{
+        return Match(Empty);
+    }
+};
+
+// index of lowest set bit in a non zero mask
+uint32_t LowestBit(uint32_t mask){
+    return static_cast<uint32_t>(__builtin_ctz(mask));
+}
+
+} // namespace
+
+// constructor
+SymbolTable::SymbolTable()
+: control(GroupSize, Empty), entries(GroupSize){}
+
+// find slot of name
+bool SymbolTable::FindSlot(uint name, size_t& slot) const{
+    uint64_t hash = HashName(name);
+    int8_t h2 = H2(hash);
+    size_t groupMask = control.size() / GroupSize - 1;
+    size_t group = H1(hash) & groupMask;
+
+    // triangular probing visits every group once when group count is a power of two
+    for(size_t probe=1; probe<=groupMask+1; probe++){
+        size_t base = group * GroupSize;
+        Group metadata(control.data() + base);
+        for(uint32_t match = metadata.Match(h2); match; match &= match - 1){
+            size_t candidate = base + LowestBit(match);
+            if(entries[candidate].name == name){
+                slot = candidate;
+                return true;
+            }
+        }
+        // name would have been put in this group if it had room
+        if(metadata.MatchEmpty()) return false;
+        group = (group + probe) & groupMask;
+    }
+    return false;
+}
+
+// find free slot for name
+size_t SymbolTable::FindFreeSlot(uint name) const{
+    uint64_t hash = HashName(name);
+    size_t groupMask = control.size() / GroupSize - 1;
+    size_t group = H1(hash) & groupMask;
+
+    // table is never full, so this always finds a slot
+    for(size_t probe=1; ; probe++){
+        size_t base = group * GroupSize;
+        uint32_t free = Group(control.data() + base).MatchFree();
+        if(free) return base + LowestBit(free);
+        group = (group + probe) & groupMask;
+    }
+}
+
+// remove binding in slot
+void SymbolTable::EraseSlot(size_t slot){
+    // no probe ever went past a group that still has an empty slot,
+    // so slot can be made empty again instead of leaving a tombstone
+    size_t base = slot & ~(GroupSize - 1);
+    if(Group(control.data() + base).MatchEmpty()){
+        control[slot] = Empty;
+    }else{
+        control[slot] = Deleted;
+        deleted++;
+    }
+    size--;
+}
+
+// rebuild table
+void SymbolTable::Rehash(size_t capacity){
+    std::vector<int8_t> oldControl(capacity, Empty);
+    std::vector<Entry> oldEntries(capacity);
+    std::swap(control, oldControl);
+    std::swap(entries, oldEntries);
+    deleted = 0;
+
+    for(size_t i=0; i<oldControl.size(); i++){
+        if(oldControl[i] < 0) continue;
+        size_t slot = FindFreeSlot(oldEntries[i].name);
+        control[slot] = oldControl[i];
+        entries[slot] = oldEntries[i];
+    }
+}
+
+// open scope
+void SymbolTable::EnterScope(){
+    scopeStarts.push_back(undoLog.size());
+}
+
+// close scope
+void SymbolTable::LeaveScope(){
+    if(scopeStarts.empty()) return;
+    size_t start = scopeStarts.back();
+    scopeStarts.pop_back();
+
+    // undo declarations in reverse order
+    while(undoLog.size() > start){
+        const UndoEntry& undo = undoLog.back();
+        size_t slot = 0;
+        FindSlot(undo.name, slot);
+        if(undo.shadowed) entries[slot] = undo.previous;
+        else EraseSlot(slot);
+        undoLog.pop_back();
+    }
+}
+
+// bind name in current scope
+bool SymbolTable::Declare(uint name, const Symbol& symbol){
+    uint depth = static_cast<uint>(scopeStarts.size());
+
+    size_t slot;
+    if(FindSlot(name, slot)){
+        Entry& entry = entries[slot];
+        if(entry.depth == depth) return false;
+        undoLog.push_back(UndoEntry{name, true, entry});
+        entry.depth = depth;
+        entry.symbol = symbol;
+        return true;
+    }
+
+    // keep at most 7/8 of slots in use, grow when live entries take more than 7/16
+    size_t capacity = control.size();
+    if((size + deleted + 1) * 8 > capacity * 7){
+        while((size + 1) * 16 > capacity * 7) capacity *= 2;
+        Rehash(capacity);
+    }
+
+    slot = FindFreeSlot(name);
+    if(control[slot] == Deleted) deleted--;
+    control[slot] = H2(HashName(name));
+    entries[slot] = Entry{name, depth, symbol};
+    size++;
+
+    // outermost scope is never left, so it needs no undo log
+    if(depth > 0) undoLog.push_back(UndoEntry{name, false, Entry{}});
+    return true;
+}
+
+// find innermost binding
+const Symbol* SymbolTable::Lookup(uint name) const{
+    size_t slot;
+    if(!FindSlot(name, slot)) return nullptr;
+    return &entries[slot].symbol;
+}
\ No newline at end of file
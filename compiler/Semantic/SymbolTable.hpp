@@ -0,0 +1,139 @@
+/**
+ * @file SymbolTable.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_COMPILER_SEMANTIC_SYMBOL_TABLE_HPP
+#define SIA_COMPILER_SEMANTIC_SYMBOL_TABLE_HPP
+
+#include <Parser/Ast.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief what a name is bound to in a scope
+ *
+ */
+struct Symbol{
+    SymbolKind kind;
+    uint index;
+};
+
+/**
+ * @brief scoped symbol table keyed by interned name ids.
+ *        All scopes share one open addressing table that only holds
+ *        the innermost binding of every name, so a lookup costs the
+ *        same no matter how deeply scopes are nested. Shadowed bindings
+ *        are saved in an undo log when a name is declared and put back
+ *        when its scope is left.
+ *
+ *        Every slot has a metadata byte holding 7 bits of the hash of
+ *        its name, or marking it as empty or deleted. Slots are probed
+ *        in groups of 16, comparing all metadata bytes of a group at
+ *        once with SSE2 when it is available. A lookup usually reads one
+ *        group of metadata and one entry.
+ */
+class SymbolTable{
+    // binding stored in a slot
+    struct Entry{
+        uint name;
+        // scope depth binding was declared in
+        uint depth;
+        Symbol symbol;
+    };
+
+    // saved state of a name before it was declared in current scope
+    struct UndoEntry{
+        uint name;
+        // false if name was not bound before
+        bool shadowed;
+        Entry previous;
+    };
+
+    // metadata byte of every slot
+    std::vector<int8_t> control;
+    // entry of every slot, only valid for full slots
+    std::vector<Entry> entries;
+    // number of full slots
+    size_t size = 0;
+    // number of deleted slots
+    size_t deleted = 0;
+
+    std::vector<UndoEntry> undoLog;
+    // undo log size at start of every open scope
+    std::vector<size_t> scopeStarts;
+
+    // find slot of name, returns false if name is not bound
+    bool FindSlot(uint name, size_t& slot) const;
+    // find a free slot to insert name in
+    size_t FindFreeSlot(uint name) const;
+    // remove binding in slot
+    void EraseSlot(size_t slot);
+    // rebuild table with given number of slots
+    void Rehash(size_t capacity);
+public:
+    SymbolTable();
+
+    /**
+     * @brief open a new scope nested in current one
+     *
+     */
+    void EnterScope();
+
+    /**
+     * @brief close current scope, names declared in it are
+     *        removed and the bindings they shadowed come back
+     *
+     */
+    void LeaveScope();
+
+    /**
+     * @brief bind name to symbol in current scope
+     *
+     * @param name interned name id
+     * @param symbol symbol to bind name to
+     * @return false if name is already declared in current scope, table is unchanged then
+     */
+    bool Declare(uint name, const Symbol& symbol);
+
+    /**
+     * @brief find innermost binding of name
+     *
+     * @param name interned name id
+     * @return const Symbol* symbol or nullptr if name is not bound,
+     *         only valid till the table is changed
+     */
+    const Symbol* Lookup(uint name) const;
+
+    /// get number of scopes currently open
+    size_t GetDepth() const{
+        return scopeStarts.size();
+    }
+};
+
+#endif//SIA_COMPILER_SEMANTIC_SYMBOL_TABLE_HPP
\ No newline at end of file
@@ -4,4 +4,5 @@ rm -vf CMakeCache.txt
 cmake .. -DPROJECT_VERSION_MAJOR=0 -DPROJECT_VERSION_MINOR=0 -DPROJECT_VERSION_PATCH=1 -DPROJECT_VERSION_TWEAK=0
 make -j4
 cd ..
-ln -svf build/siac siac
\ No newline at end of file
+ln -svf build/siac siac
+ln -svf build/vm/siavm siavm
\ No newline at end of file
@@ -1,11 +1,29 @@
 #include "Config.hpp"
+#include <Bytecode/BytecodeWriter.hpp>
+#include <CodeGen/CEmitter.hpp>
 #include <CommandLine/ArgumentParser.hpp>
-#include <Lexer/Token.hpp>
+#include <FileSystem/FileStamp.hpp>
+#include <FileSystem/TemporaryFile.hpp>
+#include <Hash/Hash.hpp>
+#include <IO/BufferedWriter.hpp>
+#include <IR/Lowering.hpp>
+#include <Lexer/Lexer.hpp>
 #include <Loggers/Log.hpp>
+#include <Module/ModuleInterface.hpp>
+#include <Optimizer/Optimizer.hpp>
+#include <Parser/Parser.hpp>
+#include <Semantic/Resolver.hpp>
+#include <Threads/ThreadPool.hpp>
+#include <algorithm>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <filesystem>
 #include <ios>
 #include <iostream>
 #include <fstream>
+#include <string>
+#include <thread>
 
 std::vector<Token> tokens;
 
@@ -30,16 +48,25 @@ public:
      * @return false end of file reached
      */
     bool Next(char& c);
+
+    /**
+     * @brief read complete file in one go
+     * 
+     * @param contents : reference to string to store file contents in
+     * @return true if file was read successfully
+     * @return false if file could not be read
+     */
+    bool ReadAll(std::string& contents);
 };
 
 // constructor
 FileReader::FileReader(const char* filename){
-    file.open(filename);
+    file.open(filename, std::ios::binary);
 }
 
 // load file
 void FileReader::LoadFile(const char *filename){
-    file.open(filename);
+    file.open(filename, std::ios::binary);
 }
 
 // get next character
@@ -48,23 +75,161 @@ bool FileReader::Next(char& c){
     return !file.eof();
 }
 
-void LexFile(const char* filename){
-    LOG(INFO, "lexing %s ...", filename)
-    FileReader file(filename);
-    char c;
-    while(file.Next(c)){
-        
+// read complete file
+bool FileReader::ReadAll(std::string& contents){
+    if(!file.is_open()) return false;
+    // size string from file size and read straight into it
+    file.seekg(0, std::ios::end);
+    std::streamoff size = file.tellg();
+    // directories report a bogus size and fail the read below
+    if(size < 0 || static_cast<size_t>(size) > contents.max_size()) return false;
+    file.seekg(0, std::ios::beg);
+    contents.resize(static_cast<size_t>(size));
+    return static_cast<bool>(file.read(contents.data(), size));
+}
+
+// get offsets where lines of source start
+std::vector<uint> GetLineStarts(const std::string& source){
+    std::vector<uint> lineStarts = {0};
+    const char* begin = source.data();
+    const char* end = begin + source.size();
+    for(const char* c = begin; (c = static_cast<const char*>(memchr(c, '\n', end - c))); c++){
+        lineStarts.push_back(static_cast<uint>(c - begin + 1));
     }
+    return lineStarts;
+}
+
+// get line and column number of given offset using line starts of source
+void GetLineAndColumn(const std::vector<uint>& lineStarts, uint offset, uint& line, uint& column){
+    auto next = std::upper_bound(lineStarts.begin(), lineStarts.end(), offset);
+    line = static_cast<uint>(next - lineStarts.begin());
+    column = offset - *(next - 1) + 1;
+}
+
+// report errors found in source and exit if there were any
+void ReportErrors(const char* filename, const std::string& source, const std::vector<Diagnostic>& errors){
+    if(errors.empty()) return;
+    // source is scanned once no matter how many errors there are
+    std::vector<uint> lineStarts = GetLineStarts(source);
+    for(const auto& error : errors){
+        uint line, column;
+        GetLineAndColumn(lineStarts, std::min<uint>(error.offset, static_cast<uint>(source.size())), line, column);
+        LOG(ERROR, "%s:%u:%u : %s", filename, line, column, error.message)
+    }
+    fflush(stdout);
+    std::quick_exit(-1);
+}
+
+void LexFile(const char* filename, const std::string& source, uint threadCount){
+    LOG(INFO, "lexing %s ...", filename)
+    LexResult result = LexSourceParallel(source.data(), source.size(), threadCount);
+    ReportErrors(filename, source, result.errors);
+    tokens = std::move(result.tokens);
     LOG(INFO, "lexing %s ... done", filename)
 }
 
+// map given interfaces and make sure they are up to date
+void LoadInterfaces(Option* option, std::vector<ModuleInterface>& interfaces){
+    if(!option) return;
+    const char* filename;
+    for(option->GetNextValue(&filename); filename; option->GetNextValue(&filename)){
+        interfaces.emplace_back();
+        ModuleInterface& interface = interfaces.back();
+        if(!interface.Open(filename)){
+            fflush(stdout);
+            std::quick_exit(-1);
+        }
+        if(!interface.IsUpToDate()){
+            LOG(ERROR, "%s is out of date with %s, it must be rebuilt", filename, interface.GetSourcePath().c_str())
+            fflush(stdout);
+            std::quick_exit(-1);
+        }
+    }
+}
+
+// get c compiler flags for optimization level,
+// SIA_C_FLAGS_O<level> in environment overrides the configured flags
+const char* GetCFlags(int level){
+    const char* names[] = {"SIA_C_FLAGS_O0", "SIA_C_FLAGS_O1", "SIA_C_FLAGS_O2", "SIA_C_FLAGS_O3"};
+    const char* defaults[] = {SIA_C_FLAGS_O0, SIA_C_FLAGS_O1, SIA_C_FLAGS_O2, SIA_C_FLAGS_O3};
+    const char* flags = getenv(names[level]);
+    return flags ? flags : defaults[level];
+}
+
+// quote argument so that shell passes it unchanged
+std::string QuoteArgument(const std::string& argument){
+    std::string quoted = "'";
+    for(char c : argument){
+        if(c == '\'') quoted += "'\\''";
+        else quoted += c;
+    }
+    return quoted + "'";
+}
+
+// write program as c and build it with c compiler if asked to
+void EmitNative(Option* emitCOption, Option* nativeOption, const Program& program, const Interner& interner, const char* filename, int optimization, ThreadPool& pool){
+    if(!emitCOption && !nativeOption) return;
+
+    const char* executable = nullptr;
+    if(nativeOption) nativeOption->GetNextValue(&executable);
+
+    // without --emit-c the C only lives till the C compiler is done with it,
+    // it gets a fresh name so that no file of the user is overwritten
+    std::string cFilename;
+    bool temporary = !emitCOption;
+    if(emitCOption){
+        const char* value;
+        emitCOption->GetNextValue(&value);
+        cFilename = value;
+    }else if(!CreateUniqueFile((std::string(executable) + ".").c_str(), ".c", cFilename)){
+        LOG(ERROR, "failed to create temporary C file for %s", executable)
+        fflush(stdout);
+        std::quick_exit(-1);
+    }
+
+    BufferedWriter writer;
+    if(!writer.Open(cFilename.c_str())){
+        LOG(ERROR, "failed to open %s", cFilename.c_str())
+        if(temporary) std::remove(cFilename.c_str());
+        fflush(stdout);
+        std::quick_exit(-1);
+    }
+    EmitC(writer, program, interner, filename, pool);
+    if(!writer.Close()){
+        LOG(ERROR, "failed to write %s", cFilename.c_str())
+        if(temporary) std::remove(cFilename.c_str());
+        fflush(stdout);
+        std::quick_exit(-1);
+    }
+
+    if(!executable) return;
+    const char* compiler = getenv("SIA_C_COMPILER");
+    std::string command = std::string(compiler ? compiler : SIA_C_COMPILER) + " " + GetCFlags(optimization)
+        + " -o " + QuoteArgument(executable) + " " + QuoteArgument(cFilename);
+    LOG(INFO, "%s", command.c_str())
+    fflush(stdout);
+    int status = std::system(command.c_str());
+    if(temporary) std::remove(cFilename.c_str());
+    if(status != 0){
+        LOG(ERROR, "c compiler failed to build %s", executable)
+        fflush(stdout);
+        std::quick_exit(-1);
+    }
+}
+
 int main(int argc, char** argv){
     // create an argument parser for parsing command line arguments
     ArgumentParser cmdLineParser;
     
     // add options to check for
     cmdLineParser.AddOption(OptionDescription("source", "list of sources to compile to one file"));
-    cmdLineParser.AddOption(OptionDescription("optimization", "optimization level to be used in optimization stage", ValueType::Integer, 1));
+    cmdLineParser.AddOption(OptionDescription("optimization", "optimization level from 0 to 3 to be used in optimization stage", ValueType::Integer, 1));
+    cmdLineParser.AddOption(OptionDescription("jobs", "number of threads to use for compiling a single source", ValueType::Integer, 1));
+    cmdLineParser.AddOption(OptionDescription("import", "list of module interfaces to import functions from"));
+    cmdLineParser.AddOption(OptionDescription("export", "write module interface of source to given file", ValueType::String, 1));
+    cmdLineParser.AddOption(OptionDescription("bytecode", "write bytecode image of source to given file", ValueType::String, 1));
+    cmdLineParser.AddOption(OptionDescription("emit-c", "write source as C11 to given file", ValueType::String, 1, 'C'));
+    cmdLineParser.AddOption(OptionDescription("native", "build native executable with given name through C compiler", ValueType::String, 1));
     
     // need atleast 3 arguments
     cmdLineParser.SetMinimumArgumentCount(3);
@@ -72,11 +237,90 @@ int main(int argc, char** argv){
     // parse arguments
     cmdLineParser.ParseArguments(argc, argv);
 
+    // use all cores unless told otherwise
+    int jobs = static_cast<int>(std::thread::hardware_concurrency());
+    Option* jobsOption = cmdLineParser.GetOption("jobs");
+    if(jobsOption) jobsOption->GetNextValue(&jobs);
+    if(jobs < 1) jobs = 1;
+
+    int optimization = 1;
+    Option* optimizationOption = cmdLineParser.GetOption("optimization");
+    if(optimizationOption) optimizationOption->GetNextValue(&optimization);
+    if(optimization < 0) optimization = 0;
+    if(optimization > 3) optimization = 3;
+
+    // c files of imported modules are not known to the compiler, so they can't be linked in
+    if(cmdLineParser.GetOption("native") && cmdLineParser.GetOption("import")){
+        LOG(ERROR, "--native can't be used with --import, write C of every module with --emit-c and link them with a C compiler instead")
+        fflush(stdout);
+        std::quick_exit(-1);
+    }
+
     Option* sources = cmdLineParser.GetOption("source");
     if(sources){
         const char* filename;
         sources->GetNextValue(&filename);
-        LexFile(filename);
+
+        // stamp is taken before reading so that an edit made while
+        // compiling makes exported interfaces look out of date
+        FileStamp sourceStamp;
+        GetFileStamp(filename, sourceStamp);
+
+        FileReader file(filename);
+        std::string source;
+        if(!file.ReadAll(source)){
+            LOG(ERROR, "failed to read %s", filename)
+            std::quick_exit(-1);
+        }
+
+        LexFile(filename, source, static_cast<uint>(jobs));
+
+        Interner interner;
+        Module module;
+        std::vector<Diagnostic> errors;
+        ParseModule(source.data(), tokens, interner, module, errors);
+        ReportErrors(filename, source, errors);
+
+        std::vector<ModuleInterface> interfaces;
+        LoadInterfaces(cmdLineParser.GetOption("import"), interfaces);
+        ResolveModule(module, interner, interfaces, errors);
+        ReportErrors(filename, source, errors);
+
+        Program program;
+        LowerModule(module, program, errors);
+        ReportErrors(filename, source, errors);
+
+        // source is hashed only when an interface or image records it
+        Option* exportOption = cmdLineParser.GetOption("export");
+        Option* bytecodeOption = cmdLineParser.GetOption("bytecode");
+        uint64_t sourceHash = 0;
+        if(exportOption || bytecodeOption) sourceHash = ChecksumBytes(source.data(), source.size());
+
+        // only export interfaces of sources that compile
+        if(exportOption){
+            const char* interfaceFilename;
+            exportOption->GetNextValue(&interfaceFilename);
+            std::string sourcePath = std::filesystem::absolute(filename).string();
+            if(!WriteModuleInterface(interfaceFilename, module, interner, sourcePath.c_str(), sourceHash, sourceStamp)){
+                fflush(stdout);
+                std::quick_exit(-1);
+            }
+        }
+
+        // functions are optimized and generated independently, one per task
+        ThreadPool pool(static_cast<uint>(jobs));
+        OptimizeProgram(program, optimization, pool);
+
+        if(bytecodeOption){
+            const char* imageFilename;
+            bytecodeOption->GetNextValue(&imageFilename);
+            if(!WriteBytecodeImage(imageFilename, program, interner, sourceHash, pool)){
+                fflush(stdout);
+                std::quick_exit(-1);
+            }
+        }
+
+        EmitNative(cmdLineParser.GetOption("emit-c"), cmdLineParser.GetOption("native"), program, interner, filename, optimization, pool);
     }else{
         LOG(ERROR, "no sources were provided to compile");
         std::quick_exit(-1);
@@ -0,0 +1,137 @@
+/**
+ * @file DeterminismTest.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+
+// functions in generated source, several batches of the largest pool below
+static constexpr uint FunctionCount = 2000;
+
+// generate an expression over parameters and calls to earlier functions
+static std::string GenerateExpression(std::mt19937& random, uint depth, uint function, uint parameterCount, const uint* parameterCounts){
+    uint choice = random() % 10;
+    if(depth == 0 || choice < 3){
+        if(parameterCount && choice % 2) return parameterCount == 1 || random() % 2 ? "a" : "b";
+        // repeated constants and parameters give the optimizer something to fold and reuse
+        return std::to_string(random() % 8);
+    }
+    if(choice == 3) return "-" + GenerateExpression(random, depth - 1, function, parameterCount, parameterCounts);
+    if(choice == 4 && function){
+        uint callee = function - 1 - random() % std::min(function, 8u);
+        std::string call = "f" + std::to_string(callee) + "(";
+        for(uint i=0; i<parameterCounts[callee]; i++){
+            if(i) call += ", ";
+            call += GenerateExpression(random, depth - 1, function, parameterCount, parameterCounts);
+        }
+        return call + ")";
+    }
+    const char* operators[] = {" + ", " - ", " * ", " / "};
+    return "(" + GenerateExpression(random, depth - 1, function, parameterCount, parameterCounts)
+        + operators[random() % 4] + GenerateExpression(random, depth - 1, function, parameterCount, parameterCounts) + ")";
+}
+
+// read complete file
+static bool ReadFile(const std::string& filename, std::string& contents){
+    std::ifstream file(filename, std::ios::binary);
+    if(!file) return false;
+    contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// compile source with siac, output files are named after jobs and optimization
+static bool Compile(const std::string& siac, const std::string& directory, uint jobs, int optimization){
+    std::string name = directory + "/determinism_j" + std::to_string(jobs) + "_o" + std::to_string(optimization);
+    std::string command = "'" + siac + "' --source '" + directory + "/determinism.sia'"
+        + " --bytecode '" + name + ".siab' --emit-c '" + name + ".c'"
+        + " --jobs " + std::to_string(jobs) + " --optimization " + std::to_string(optimization) + " > /dev/null";
+    return std::system(command.c_str()) == 0;
+}
+
+// check that siac output doesn't depend on number of threads
+int main(int argc, char** argv){
+    if(argc != 3){
+        printf("usage : %s <siac> <work directory>\n", argv[0]);
+        return 1;
+    }
+    std::string siac = argv[1];
+    std::string directory = argv[2];
+
+    std::mt19937 random(31);
+    uint parameterCounts[FunctionCount];
+    std::string source;
+    for(uint i=0; i<FunctionCount; i++){
+        parameterCounts[i] = random() % 3;
+        source += "fn f" + std::to_string(i) + "(";
+        if(parameterCounts[i] >= 1) source += "a";
+        if(parameterCounts[i] == 2) source += ", b";
+        source += ") = " + GenerateExpression(random, 4, i, parameterCounts[i], parameterCounts) + ";\n";
+    }
+    source += "fn main() = 1;\n";
+
+    std::ofstream file(directory + "/determinism.sia", std::ios::binary | std::ios::trunc);
+    file << source;
+    file.close();
+    if(!file){
+        printf("[FAIL] : failed to write source\n");
+        return 1;
+    }
+
+    uint failures = 0;
+    for(int optimization : {0, 2}){
+        if(!Compile(siac, directory, 1, optimization)){
+            printf("[FAIL] : siac failed with 1 job at optimization %d\n", optimization);
+            failures++;
+            continue;
+        }
+        for(uint jobs : {2u, 3u, 8u}){
+            if(!Compile(siac, directory, jobs, optimization)){
+                printf("[FAIL] : siac failed with %u jobs at optimization %d\n", jobs, optimization);
+                failures++;
+                continue;
+            }
+            for(const char* extension : {".siab", ".c"}){
+                std::string expected, actual;
+                std::string prefix = directory + "/determinism_j";
+                std::string suffix = "_o" + std::to_string(optimization) + extension;
+                if(!ReadFile(prefix + "1" + suffix, expected) || !ReadFile(prefix + std::to_string(jobs) + suffix, actual) || expected != actual){
+                    printf("[FAIL] : %s output with %u jobs at optimization %d differs from output with 1 job\n", extension, jobs, optimization);
+                    failures++;
+                }
+            }
+        }
+    }
+
+    printf("%u checks failed\n", failures);
+    return failures ? 1 : 0;
+}
\ No newline at end of file
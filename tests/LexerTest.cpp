@@ -0,0 +1,103 @@
+/**
+ * @file LexerTest.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <Lexer/Lexer.hpp>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+
+// pieces sources are generated from, strings, escapes and comments
+// contain newlines so that they cross chunk boundaries
+static const char* const Pieces[] = {
+    "foo ", "bar_1 ", "123 ", "4.5 ", "true ", "false ", "fn ", "( ", ") ", ", ", "= ", "; ",
+    "+", "-", "*", "/", "\n", "  \n\n",
+    "\"plain\" ",
+    "\"escaped \\\" quote\" ",
+    "\"escaped \\\\\" ",
+    "\"multi\nline\n string\" ",
+    "\"ends in escape \\\n\" ",
+    "/* block */",
+    "/* multi\n line \" with quote\n */",
+    "/* stars ** // slashes \n*/",
+    "// line comment \" with quote /*\n",
+    // these leave a string or comment open till a later piece closes it
+    "\"", "/*", "*/", "\\", "@", " 99999999999999999999 ",
+};
+
+static constexpr size_t PieceCount = sizeof(Pieces) / sizeof(Pieces[0]);
+// pieces before this never leave anything open
+static constexpr size_t ClosedPieceCount = PieceCount - 6;
+
+// check that two lex results are identical
+static bool Equal(const LexResult& expected, const LexResult& actual){
+    if(expected.tokens.size() != actual.tokens.size() || expected.errors.size() != actual.errors.size()) return false;
+    for(size_t i=0; i<expected.tokens.size(); i++){
+        const Token& a = expected.tokens[i];
+        const Token& b = actual.tokens[i];
+        if(a.type != b.type || a.value != b.value || a.offset != b.offset || a.length != b.length) return false;
+    }
+    for(size_t i=0; i<expected.errors.size(); i++){
+        const Diagnostic& a = expected.errors[i];
+        const Diagnostic& b = actual.errors[i];
+        if(a.offset != b.offset || strcmp(a.message, b.message) != 0) return false;
+    }
+    return true;
+}
+
+// compare parallel lexer with sequential lexer on generated sources
+int main(){
+    std::mt19937 random(2021);
+    uint failures = 0;
+    uint comparisons = 0;
+
+    for(uint iteration=0; iteration<200; iteration++){
+        // half of sources only use pieces that are always closed
+        size_t pieceCount = iteration % 2 ? PieceCount : ClosedPieceCount;
+        size_t size = 256 + random() % 8192;
+        std::string source;
+        while(source.size() < size) source += Pieces[random() % pieceCount];
+
+        LexResult expected = LexSource(source.data(), source.size());
+        for(uint threadCount : {2u, 3u, 8u, 32u}){
+            for(size_t minChunkSize : {1u, 16u, 200u}){
+                LexResult actual = LexSourceParallel(source.data(), source.size(), threadCount, minChunkSize);
+                comparisons++;
+                if(!Equal(expected, actual)){
+                    failures++;
+                    printf("[FAIL] : source %u with %u threads and chunks of at least %zu bytes differs from sequential lexer\n",
+                        iteration, threadCount, minChunkSize);
+                }
+            }
+        }
+    }
+
+    printf("%u of %u comparisons failed\n", failures, comparisons);
+    return failures ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+/**
+ * @file ParserTest.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <Lexer/Lexer.hpp>
+#include <Parser/Parser.hpp>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// parse source and check whether it reported given error, or no error if message is null
+static bool ParseReports(const std::string& source, const char* message){
+    LexResult lexed = LexSource(source.data(), source.size());
+    if(!lexed.errors.empty()) return false;
+
+    Interner interner;
+    Module module;
+    std::vector<Diagnostic> errors;
+    bool parsed = ParseModule(source.data(), lexed.tokens, interner, module, errors);
+    if(!message) return parsed && errors.empty();
+    for(const auto& error : errors){
+        if(strcmp(error.message, message) == 0) return !parsed;
+    }
+    return false;
+}
+
+// repeat string count times
+static std::string Repeat(const char* str, size_t count){
+    std::string result;
+    result.reserve(strlen(str) * count);
+    for(size_t i=0; i<count; i++) result += str;
+    return result;
+}
+
+// check that deeply nested expressions are rejected instead of overflowing the stack
+int main(){
+    const char* const TooDeep = "expression is nested too deeply";
+    const size_t Deep = 200000;
+    const size_t Shallow = 200;
+    uint failures = 0;
+
+    auto check = [&](const char* name, const std::string& source, const char* message){
+        if(!ParseReports(source, message)){
+            failures++;
+            printf("[FAIL] : %s\n", name);
+        }
+    };
+
+    check("shallow parentheses", "fn main() = " + Repeat("(", Shallow) + "1" + Repeat(")", Shallow) + ";", nullptr);
+    check("shallow negations", "fn main() = " + Repeat("-", Shallow) + "1;", nullptr);
+    check("shallow calls", "fn f(x) = x;\nfn main() = " + Repeat("f(", Shallow) + "1" + Repeat(")", Shallow) + ";", nullptr);
+
+    check("deep parentheses", "fn main() = " + Repeat("(", Deep) + "1" + Repeat(")", Deep) + ";", TooDeep);
+    check("deep negations", "fn main() = " + Repeat("-", Deep) + "1;", TooDeep);
+    check("deep calls", "fn f(x) = x;\nfn main() = " + Repeat("f(", Deep) + "1" + Repeat(")", Deep) + ";", TooDeep);
+    check("deep mixed nesting", "fn main() = " + Repeat("-(1 + ", Deep) + "1" + Repeat(")", Deep) + ";", TooDeep);
+
+    // long but flat expressions are not nested and must still parse
+    check("long sum", "fn main() = 1" + Repeat(" + 1", Deep) + ";", nullptr);
+
+    printf("%u checks failed\n", failures);
+    return failures ? 1 : 0;
+}
\ No newline at end of file
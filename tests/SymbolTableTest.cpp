@@ -0,0 +1,179 @@
+/**
+ * @file SymbolTableTest.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <Semantic/SymbolTable.hpp>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <vector>
+
+/**
+ * reference symbol table, a chain of scopes each holding its own map.
+ * Lookups walk the chain from innermost scope outwards.
+ */
+class ScopeChain{
+    std::vector<std::map<uint, uint>> scopes = std::vector<std::map<uint, uint>>(1);
+public:
+    void EnterScope(){
+        scopes.emplace_back();
+    }
+
+    void LeaveScope(){
+        scopes.pop_back();
+    }
+
+    bool Declare(uint name, uint index){
+        return scopes.back().emplace(name, index).second;
+    }
+
+    const uint* Lookup(uint name) const{
+        for(auto scope = scopes.rbegin(); scope != scopes.rend(); scope++){
+            auto it = scope->find(name);
+            if(it != scope->end()) return &it->second;
+        }
+        return nullptr;
+    }
+
+    size_t GetDepth() const{
+        return scopes.size() - 1;
+    }
+};
+
+static uint failures = 0;
+
+// check that table and model agree on name
+static void CheckLookup(const SymbolTable& table, const ScopeChain& model, uint name, const char* context){
+    const Symbol* symbol = table.Lookup(name);
+    const uint* index = model.Lookup(name);
+    if((symbol == nullptr) != (index == nullptr) || (symbol && symbol->index != *index)){
+        failures++;
+        printf("[FAIL] : %s : lookup of name %u differs from scope chain\n", context, name);
+    }
+}
+
+// declare name in both and check that they agree on the result
+static void CheckDeclare(SymbolTable& table, ScopeChain& model, uint name, uint index, const char* context){
+    bool declared = table.Declare(name, Symbol{SymbolKind::Parameter, index});
+    if(declared != model.Declare(name, index)){
+        failures++;
+        printf("[FAIL] : %s : declaring name %u differs from scope chain\n", context, name);
+    }
+}
+
+// shadowing, restoring shadowed names and redeclaration in one scope
+static void TestScopes(){
+    SymbolTable table;
+    ScopeChain model;
+
+    CheckDeclare(table, model, 1, 10, "declare in root scope");
+    CheckDeclare(table, model, 1, 11, "redeclare in root scope");
+    CheckLookup(table, model, 1, "redeclaration keeps first binding");
+
+    table.EnterScope();
+    model.EnterScope();
+    CheckDeclare(table, model, 1, 20, "shadow in nested scope");
+    CheckLookup(table, model, 1, "shadowing binding is found");
+    CheckDeclare(table, model, 1, 21, "redeclare in nested scope");
+    CheckDeclare(table, model, 2, 22, "declare new name in nested scope");
+
+    table.EnterScope();
+    model.EnterScope();
+    CheckDeclare(table, model, 1, 30, "shadow twice");
+    CheckLookup(table, model, 2, "outer binding visible in inner scope");
+    table.LeaveScope();
+    model.LeaveScope();
+    CheckLookup(table, model, 1, "binding shadowed once is restored");
+
+    table.LeaveScope();
+    model.LeaveScope();
+    CheckLookup(table, model, 1, "root binding is restored");
+    CheckLookup(table, model, 2, "nested name is gone after its scope");
+    CheckLookup(table, model, 3, "never declared name");
+}
+
+// random operations compared with scope chain
+static void TestRandom(uint seed, uint nameCount, uint operationCount){
+    std::mt19937 random(seed);
+    SymbolTable table;
+    ScopeChain model;
+
+    for(uint operation=0; operation<operationCount; operation++){
+        uint choice = random() % 100;
+        if(choice < 6 && model.GetDepth() < 64){
+            table.EnterScope();
+            model.EnterScope();
+        }else if(choice < 12 && model.GetDepth() > 0){
+            table.LeaveScope();
+            model.LeaveScope();
+        }else if(choice < 55){
+            CheckDeclare(table, model, random() % nameCount, random(), "random declare");
+        }else{
+            CheckLookup(table, model, random() % nameCount, "random lookup");
+        }
+        if(table.GetDepth() != model.GetDepth()){
+            failures++;
+            printf("[FAIL] : random : depth differs from scope chain\n");
+        }
+        if(failures > 20) return;
+    }
+}
+
+// big scopes filled and dropped over and over, growing the table and
+// leaving many erased slots behind that later inserts must reuse
+static void TestChurn(){
+    std::mt19937 random(28);
+    SymbolTable table;
+    ScopeChain model;
+    for(uint name=0; name<1000; name++) CheckDeclare(table, model, name * 7, name, "churn root");
+
+    for(uint round=0; round<40; round++){
+        table.EnterScope();
+        model.EnterScope();
+        uint count = 1000 + random() % 20000;
+        for(uint i=0; i<count; i++) CheckDeclare(table, model, random() % 50000, i, "churn declare");
+        for(uint i=0; i<2000; i++) CheckLookup(table, model, random() % 50000, "churn lookup");
+        table.LeaveScope();
+        model.LeaveScope();
+        for(uint name=0; name<1000; name++) CheckLookup(table, model, name * 7, "churn root survives");
+        if(failures > 20) return;
+    }
+}
+
+// compare symbol table with a scope chain of maps
+int main(){
+    TestScopes();
+    // few names make shadowing and redeclaration common, many names make the table grow
+    TestRandom(1, 8, 100000);
+    TestRandom(2, 200, 100000);
+    TestRandom(3, 100000, 200000);
+    TestChurn();
+
+    printf("%u checks failed\n", failures);
+    return failures ? 1 : 0;
+}
\ No newline at end of file
@@ -176,11 +176,12 @@ struct OptionDescription{
      * @param helpString help string for option
      * @param valueType what type of value to accept
      * @param valueCount number of values to be accepted for option (-1 means infinite values)
+     * @param shortHand short hand notation for option (0 means initial of name)
      */
-    OptionDescription(const char* name, const char* helpString, const ValueType& valueType = ValueType::String, int valueCount = -1)
+    OptionDescription(const char* name, const char* helpString, const ValueType& valueType = ValueType::String, int valueCount = -1, char shortHand = 0)
     : name(name), helpString(helpString), valueType(valueType), valueCount(valueCount){
         // short hand is initial of help string until unless explicitly stated
-        shortHand = name[0];
+        this->shortHand = shortHand ? shortHand : name[0];
     }
     
     /// option name
@@ -0,0 +1,55 @@
+/**
+ * @file FileStamp.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_UTILS_FILE_SYSTEM_FILE_STAMP_HPP
+#define SIA_UTILS_FILE_SYSTEM_FILE_STAMP_HPP
+
+#include <cstdint>
+
+/**
+ * @brief size and modification time of a file.
+ *        Comparing stamps is a cheap check for whether a file
+ *        changed, without reading its contents.
+ */
+struct FileStamp{
+    uint64_t size = 0;
+    /// modification time in nanoseconds since epoch
+    int64_t modifiedTime = 0;
+};
+
+/**
+ * @brief get stamp of file with given name
+ *
+ * @param filename name of file
+ * @param stamp filled in if file exists
+ * @return true if file exists
+ */
+bool GetFileStamp(const char* filename, FileStamp& stamp);
+
+#endif//SIA_UTILS_FILE_SYSTEM_FILE_STAMP_HPP
\ No newline at end of file
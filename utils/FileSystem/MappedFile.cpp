@@ -0,0 +1,94 @@
+/**
+ * @file MappedFile.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "MappedFile.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+// destructor
+MappedFile::~MappedFile(){
+    Close();
+}
+
+// move constructor
+MappedFile::MappedFile(MappedFile&& other) noexcept
+: data(other.data), size(other.size){
+    other.data = nullptr;
+    other.size = 0;
+}
+
+// move assignment
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept{
+    if(this != &other){
+        Close();
+        std::swap(data, other.data);
+        std::swap(size, other.size);
+    }
+    return *this;
+}
+
+// map file
+bool MappedFile::Open(const char* filename){
+    Close();
+
+    int fd = open(filename, O_RDONLY);
+    if(fd < 0) return false;
+
+    struct stat info;
+    if(fstat(fd, &info) != 0){
+        close(fd);
+        return false;
+    }
+
+    // mmap doesn't accept empty mappings
+    if(info.st_size == 0){
+        close(fd);
+        data = "";
+        return true;
+    }
+
+    void* mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // mapping stays valid after closing the descriptor
+    close(fd);
+    if(mapping == MAP_FAILED) return false;
+
+    data = static_cast<const char*>(mapping);
+    size = static_cast<size_t>(info.st_size);
+    return true;
+}
+
+// unmap file
+void MappedFile::Close(){
+    if(data && size) munmap(const_cast<char*>(data), size);
+    data = nullptr;
+    size = 0;
+}
\ No newline at end of file
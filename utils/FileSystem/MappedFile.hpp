@@ -0,0 +1,80 @@
+/**
+ * @file MappedFile.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_UTILS_FILE_SYSTEM_MAPPED_FILE_HPP
+#define SIA_UTILS_FILE_SYSTEM_MAPPED_FILE_HPP
+
+#include <cstddef>
+
+/**
+ * @brief read only memory mapping of a complete file.
+ *        Pages are loaded by the OS only when they are touched,
+ *        so mapping a large file costs almost nothing until it is read.
+ */
+class MappedFile{
+    // start of mapping
+    const char* data = nullptr;
+    // size of mapped file
+    size_t size = 0;
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief map file with given name, unmaps previously mapped file
+     *
+     * @param filename name of file to map
+     * @return true if file was mapped
+     * @return false if file could not be opened or mapped
+     */
+    bool Open(const char* filename);
+
+    /**
+     * @brief unmap mapped file, does nothing if no file is mapped
+     *
+     */
+    void Close();
+
+    /// get pointer to start of mapped file
+    const char* GetData() const{
+        return data;
+    }
+
+    /// get size of mapped file
+    size_t GetSize() const{
+        return size;
+    }
+};
+
+#endif//SIA_UTILS_FILE_SYSTEM_MAPPED_FILE_HPP
\ No newline at end of file
@@ -0,0 +1,101 @@
+/**
+ * @file TemporaryFile.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "TemporaryFile.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+// destructor
+TemporaryFile::~TemporaryFile(){
+    if(fd >= 0){
+        close(fd);
+        unlink(path.c_str());
+    }
+}
+
+// create temporary file
+bool TemporaryFile::Create(const char* destination){
+    this->destination = destination;
+    path = this->destination + ".XXXXXX";
+    std::vector<char> name(path.begin(), path.end());
+    name.push_back(0);
+    fd = mkstemp(name.data());
+    if(fd < 0) return false;
+    path = name.data();
+
+    // mkstemp creates files only the owner can read, use usual permissions instead
+    mode_t mask = umask(0);
+    umask(mask);
+    fchmod(fd, 0666 & ~mask);
+    good = true;
+    return true;
+}
+
+// write data
+bool TemporaryFile::Write(const void* data, size_t size){
+    const char* bytes = static_cast<const char*>(data);
+    while(good && size){
+        ssize_t written = write(fd, bytes, size);
+        if(written < 0){
+            if(errno == EINTR) continue;
+            good = false;
+            break;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+    return good;
+}
+
+// rename over destination
+bool TemporaryFile::Commit(){
+    if(fd < 0) return false;
+    bool success = good && close(fd) == 0;
+    fd = -1;
+    if(success) success = std::rename(path.c_str(), destination.c_str()) == 0;
+    if(!success) unlink(path.c_str());
+    return success;
+}
+
+// create uniquely named file
+bool CreateUniqueFile(const char* prefix, const char* suffix, std::string& name){
+    std::string pattern = std::string(prefix) + "XXXXXX" + suffix;
+    std::vector<char> buffer(pattern.begin(), pattern.end());
+    buffer.push_back(0);
+    int fd = mkstemps(buffer.data(), static_cast<int>(strlen(suffix)));
+    if(fd < 0) return false;
+    close(fd);
+    name = buffer.data();
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+/**
+ * @file TemporaryFile.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_UTILS_FILE_SYSTEM_TEMPORARY_FILE_HPP
+#define SIA_UTILS_FILE_SYSTEM_TEMPORARY_FILE_HPP
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief uniquely named file next to a destination that is renamed
+ *        over the destination once it is completely written. Readers
+ *        of destination never see a partially written file, and
+ *        processes writing the same destination at the same time
+ *        don't overwrite each other's temporary files.
+ *        The temporary file is removed if it is never committed.
+ */
+class TemporaryFile{
+    int fd = -1;
+    std::string path;
+    std::string destination;
+    // false once a write failed
+    bool good = true;
+public:
+    TemporaryFile() = default;
+    ~TemporaryFile();
+
+    TemporaryFile(const TemporaryFile&) = delete;
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+    /**
+     * @brief create temporary file in directory of destination
+     *
+     * @param destination name of file to replace on commit
+     * @return true if file was created
+     */
+    bool Create(const char* destination);
+
+    /**
+     * @brief append data to file
+     *
+     * @param data pointer to data
+     * @param size number of bytes to write
+     * @return true if everything written so far was written
+     */
+    bool Write(const void* data, size_t size);
+
+    /**
+     * @brief close file and rename it over destination
+     *
+     * @return true if destination was replaced
+     */
+    bool Commit();
+};
+
+/**
+ * @brief create a new empty file whose name is prefix, six random
+ *        characters and suffix. The file is never an existing one,
+ *        so nothing is overwritten. Caller deletes it when done.
+ *
+ * @param prefix start of name, including directory
+ * @param suffix end of name, like an extension
+ * @param name filled in with name of created file
+ * @return true if file was created
+ */
+bool CreateUniqueFile(const char* prefix, const char* suffix, std::string& name);
+
+#endif//SIA_UTILS_FILE_SYSTEM_TEMPORARY_FILE_HPP
\ No newline at end of file
@@ -0,0 +1,160 @@
+/**
+ * @file Hash.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_UTILS_HASH_HASH_HPP
+#define SIA_UTILS_HASH_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/// initial value for HashBytes
+constexpr uint64_t HashSeed = 0xcbf29ce484222325ull;
+
+/**
+ * @brief hash bytes using 64 bit FNV-1a.
+ *        Hash of data split into parts can be computed by
+ *        passing hash of previous part as seed of next part.
+ *        The value is stored in files, so never change it.
+ *
+ * @param data pointer to bytes to hash
+ * @param size number of bytes to hash
+ * @param seed hash to continue from
+ * @return uint64_t hash
+ */
+inline uint64_t HashBytes(const void* data, size_t size, uint64_t seed = HashSeed){
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t hash = seed;
+    for(size_t i=0; i<size; i++){
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+namespace detail{
+
+constexpr uint64_t ChecksumPrime1 = 0x9e3779b185ebca87ull;
+constexpr uint64_t ChecksumPrime2 = 0xc2b2ae3d27d4eb4full;
+constexpr uint64_t ChecksumPrime3 = 0x165667b19e3779f9ull;
+constexpr uint64_t ChecksumPrime4 = 0x85ebca77c2b2ae63ull;
+constexpr uint64_t ChecksumPrime5 = 0x27d4eb2f165667c5ull;
+
+inline uint64_t RotateLeft(uint64_t value, int count){
+    return (value << count) | (value >> (64 - count));
+}
+
+inline uint64_t ChecksumRound(uint64_t accumulator, uint64_t input){
+    accumulator += input * ChecksumPrime2;
+    return RotateLeft(accumulator, 31) * ChecksumPrime1;
+}
+
+inline uint64_t ChecksumMerge(uint64_t hash, uint64_t accumulator){
+    hash ^= ChecksumRound(0, accumulator);
+    return hash * ChecksumPrime1 + ChecksumPrime4;
+}
+
+inline uint64_t Read64(const unsigned char* bytes){
+    uint64_t value;
+    memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+inline uint32_t Read32(const unsigned char* bytes){
+    uint32_t value;
+    memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+} // namespace detail
+
+/**
+ * @brief checksum bytes using XXH64.
+ *        Unlike HashBytes this consumes 32 bytes per step in four
+ *        independent lanes, so it runs at about memory speed and is
+ *        meant for checksumming whole files. Words are read in native
+ *        byte order. The value is stored in files, so never change it.
+ *
+ * @param data pointer to bytes to checksum
+ * @param size number of bytes to checksum
+ * @param seed seed of checksum
+ * @return uint64_t checksum
+ */
+inline uint64_t ChecksumBytes(const void* data, size_t size, uint64_t seed = 0){
+    using namespace detail;
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    const unsigned char* end = bytes + size;
+    uint64_t hash;
+
+    if(size >= 32){
+        uint64_t lane1 = seed + ChecksumPrime1 + ChecksumPrime2;
+        uint64_t lane2 = seed + ChecksumPrime2;
+        uint64_t lane3 = seed;
+        uint64_t lane4 = seed - ChecksumPrime1;
+        do{
+            lane1 = ChecksumRound(lane1, Read64(bytes));
+            lane2 = ChecksumRound(lane2, Read64(bytes + 8));
+            lane3 = ChecksumRound(lane3, Read64(bytes + 16));
+            lane4 = ChecksumRound(lane4, Read64(bytes + 24));
+            bytes += 32;
+        }while(end - bytes >= 32);
+
+        hash = RotateLeft(lane1, 1) + RotateLeft(lane2, 7) + RotateLeft(lane3, 12) + RotateLeft(lane4, 18);
+        hash = ChecksumMerge(hash, lane1);
+        hash = ChecksumMerge(hash, lane2);
+        hash = ChecksumMerge(hash, lane3);
+        hash = ChecksumMerge(hash, lane4);
+    }else{
+        hash = seed + ChecksumPrime5;
+    }
+    hash += size;
+
+    for(; end - bytes >= 8; bytes += 8){
+        hash ^= ChecksumRound(0, Read64(bytes));
+        hash = RotateLeft(hash, 27) * ChecksumPrime1 + ChecksumPrime4;
+    }
+    if(end - bytes >= 4){
+        hash ^= uint64_t(Read32(bytes)) * ChecksumPrime1;
+        hash = RotateLeft(hash, 23) * ChecksumPrime2 + ChecksumPrime3;
+        bytes += 4;
+    }
+    for(; bytes < end; bytes++){
+        hash ^= *bytes * ChecksumPrime5;
+        hash = RotateLeft(hash, 11) * ChecksumPrime1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= ChecksumPrime2;
+    hash ^= hash >> 29;
+    hash *= ChecksumPrime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+#endif//SIA_UTILS_HASH_HASH_HPP
\ No newline at end of file
@@ -0,0 +1,52 @@
+/**
+ * @file ArenaWriter.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "ArenaWriter.hpp"
+#include <cstring>
+
+// write bytes
+void ArenaWriter::Write(const char* bytes, size_t count){
+    if(size + count > capacity){
+        // old memory is given back to arena only when it's reset, doubling
+        // keeps that waste below size of the final output
+        size_t newCapacity = capacity ? capacity * 2 : 256;
+        while(newCapacity < size + count) newCapacity *= 2;
+        char* newData = static_cast<char*>(arena.Allocate(newCapacity, 1));
+        if(size) memcpy(newData, data, size);
+        data = newData;
+        capacity = newCapacity;
+    }
+    memcpy(data + size, bytes, count);
+    size += count;
+}
+
+// write null terminated string
+void ArenaWriter::Write(const char* str){
+    Write(str, strlen(str));
+}
\ No newline at end of file
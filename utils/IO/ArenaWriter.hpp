@@ -0,0 +1,76 @@
+/**
+ * @file ArenaWriter.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_UTILS_IO_ARENA_WRITER_HPP
+#define SIA_UTILS_IO_ARENA_WRITER_HPP
+
+#include "../Memory/Arena.hpp"
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief writes into memory taken from an arena.
+ *        Has the same Write functions as BufferedWriter, so code that
+ *        generates text can write to either. Output stays valid till
+ *        the arena is reset.
+ */
+class ArenaWriter{
+    Arena& arena;
+    char* data = nullptr;
+    // number of bytes written
+    size_t size = 0;
+    // number of bytes data can hold
+    size_t capacity = 0;
+public:
+    explicit ArenaWriter(Arena& arena)
+    : arena(arena){}
+
+    /// write bytes
+    void Write(const char* data, size_t size);
+
+    /// write null terminated string
+    void Write(const char* str);
+
+    /// write string
+    void Write(const std::string& str){
+        Write(str.data(), str.size());
+    }
+
+    /// get written bytes
+    const char* GetData() const{
+        return data;
+    }
+
+    /// get number of written bytes
+    size_t GetSize() const{
+        return size;
+    }
+};
+
+#endif//SIA_UTILS_IO_ARENA_WRITER_HPP
\ No newline at end of file
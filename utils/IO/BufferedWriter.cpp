@@ -0,0 +1,96 @@
+/**
+ * @file BufferedWriter.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "BufferedWriter.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+// destructor
+BufferedWriter::~BufferedWriter(){
+    Close();
+}
+
+// open file
+bool BufferedWriter::Open(const char* filename){
+    Close();
+    fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    good = fd >= 0;
+    return good;
+}
+
+// close file
+bool BufferedWriter::Close(){
+    if(fd < 0) return good;
+    Flush();
+    if(close(fd) != 0) good = false;
+    fd = -1;
+    return good;
+}
+
+// write buffer to file
+void BufferedWriter::Flush(){
+    size_t written = 0;
+    while(good && fd >= 0 && written < used){
+        ssize_t count = write(fd, buffer + written, used - written);
+        // interrupted before anything was written, try again
+        if(count < 0 && errno == EINTR) continue;
+        if(count < 0) good = false;
+        else written += static_cast<size_t>(count);
+    }
+    used = 0;
+}
+
+// write bytes
+void BufferedWriter::Write(const char* data, size_t size){
+    // large writes bypass the buffer
+    if(size >= BufferSize){
+        Flush();
+        while(good && fd >= 0 && size > 0){
+            ssize_t count = write(fd, data, size);
+            if(count < 0 && errno == EINTR) continue;
+            if(count < 0) good = false;
+            else{
+                data += count;
+                size -= static_cast<size_t>(count);
+            }
+        }
+        return;
+    }
+
+    if(used + size > BufferSize) Flush();
+    memcpy(buffer + used, data, size);
+    used += size;
+}
+
+// write null terminated string
+void BufferedWriter::Write(const char* str){
+    Write(str, strlen(str));
+}
@@ -0,0 +1,92 @@
+/**
+ * @file BufferedWriter.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_UTILS_IO_BUFFERED_WRITER_HPP
+#define SIA_UTILS_IO_BUFFERED_WRITER_HPP
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief writes to a file through a fixed size buffer.
+ *        Output is handed to the OS every time the buffer fills,
+ *        so memory used doesn't depend on how much is written.
+ */
+class BufferedWriter{
+    // size of buffer
+    static constexpr size_t BufferSize = 1 << 16;
+
+    char buffer[BufferSize];
+    // number of bytes in buffer
+    size_t used = 0;
+    // file descriptor, -1 if no file is open
+    int fd = -1;
+    // false once a write to file fails
+    bool good = true;
+public:
+    BufferedWriter() = default;
+    ~BufferedWriter();
+
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    /**
+     * @brief create or truncate file to write to
+     *
+     * @param filename name of file
+     * @return true if file was opened
+     */
+    bool Open(const char* filename);
+
+    /**
+     * @brief flush buffer and close file
+     *
+     * @return true if everything written since Open reached the file
+     */
+    bool Close();
+
+    /**
+     * @brief hand buffered bytes to the OS
+     *
+     */
+    void Flush();
+
+    /// write bytes
+    void Write(const char* data, size_t size);
+
+    /// write null terminated string
+    void Write(const char* str);
+
+    /// write string
+    void Write(const std::string& str){
+        Write(str.data(), str.size());
+    }
+};
+
+#endif//SIA_UTILS_IO_BUFFERED_WRITER_HPP
\ No newline at end of file
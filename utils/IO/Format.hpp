@@ -0,0 +1,51 @@
+/**
+ * @file Format.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_UTILS_IO_FORMAT_HPP
+#define SIA_UTILS_IO_FORMAT_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief write integer in decimal
+ *
+ * @tparam Writer any writer with Write(const char* data, size_t size)
+ * @param writer writer to write to
+ * @param value integer to write
+ */
+template<typename Writer>
+void WriteInteger(Writer& writer, int64_t value){
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    writer.Write(digits, static_cast<size_t>(result.ptr - digits));
+}
+
+#endif//SIA_UTILS_IO_FORMAT_HPP
\ No newline at end of file
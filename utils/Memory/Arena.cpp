@@ -0,0 +1,51 @@
+/**
+ * @file Arena.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "Arena.hpp"
+
+// allocate memory, blocks from new[] are aligned for any fundamental type
+void* Arena::Allocate(size_t size, size_t alignment){
+    while(current < blocks.size()){
+        Block& block = blocks[current];
+        size_t offset = (used + alignment - 1) & ~(alignment - 1);
+        if(offset + size <= block.size){
+            used = offset + size;
+            return block.data.get() + offset;
+        }
+        current++;
+        used = 0;
+    }
+
+    // large requests get a block of their own
+    size_t blockSize = size > BlockSize ? size : BlockSize;
+    blocks.push_back(Block{std::unique_ptr<char[]>(new char[blockSize]), blockSize});
+    current = blocks.size() - 1;
+    used = size;
+    return blocks.back().data.get();
+}
\ No newline at end of file
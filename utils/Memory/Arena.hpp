@@ -0,0 +1,94 @@
+/**
+ * @file Arena.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_UTILS_MEMORY_ARENA_HPP
+#define SIA_UTILS_MEMORY_ARENA_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief bump allocator for short lived scratch memory.
+ *        Memory is handed out from large blocks and only given back
+ *        all at once by Reset, which keeps the blocks for reuse. An
+ *        arena is not thread safe, give every thread its own.
+ */
+class Arena{
+    // size of blocks allocated for small requests
+    static constexpr size_t BlockSize = 1 << 16;
+
+    struct Block{
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks;
+    // block allocations are currently made from
+    size_t current = 0;
+    // bytes used in current block
+    size_t used = 0;
+public:
+    /**
+     * @brief allocate uninitialized memory
+     *
+     * @param size number of bytes
+     * @param alignment alignment of memory, a power of two not above alignof(std::max_align_t)
+     * @return void* pointer to memory valid till next Reset
+     */
+    void* Allocate(size_t size, size_t alignment);
+
+    /**
+     * @brief allocate array of zero initialized values
+     *
+     * @tparam T trivial type of values
+     * @param count number of values
+     * @return T* pointer to first value, valid till next Reset
+     */
+    template<typename T>
+    T* AllocateArray(size_t count){
+        static_assert(std::is_trivial<T>::value, "arena only holds trivial types");
+        void* memory = Allocate(count * sizeof(T), alignof(T));
+        memset(memory, 0, count * sizeof(T));
+        return static_cast<T*>(memory);
+    }
+
+    /**
+     * @brief free everything allocated so far, blocks are kept for reuse
+     *
+     */
+    void Reset(){
+        current = 0;
+        used = 0;
+    }
+};
+
+#endif//SIA_UTILS_MEMORY_ARENA_HPP
\ No newline at end of file
@@ -0,0 +1,78 @@
+/**
+ * @file Interner.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_UTILS_STRINGS_INTERNER_HPP
+#define SIA_UTILS_STRINGS_INTERNER_HPP
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+typedef unsigned int uint;
+
+/**
+ * @brief stores one copy of every string given to it and
+ *        gives each unique string a small integer id.
+ *        Ids are given in increasing order starting from 0,
+ *        comparing two interned strings is comparing two ids.
+ */
+class Interner{
+    // deque never moves its elements, views into them stay valid
+    std::deque<std::string> strings;
+    // maps string to its id
+    std::unordered_map<std::string_view, uint> ids;
+public:
+    /**
+     * @brief get id of given string, string is stored if it is new
+     *
+     * @param str pointer to string, need not be null terminated
+     * @param length length of string
+     * @return uint id of string
+     */
+    uint Intern(const char* str, size_t length);
+
+    /**
+     * @brief get string with given id
+     *
+     * @param id of string returned by Intern
+     * @return const std::string& interned string
+     */
+    const std::string& GetString(uint id) const{
+        return strings[id];
+    }
+
+    /// get number of unique strings interned so far
+    size_t GetCount() const{
+        return strings.size();
+    }
+};
+
+#endif//SIA_UTILS_STRINGS_INTERNER_HPP
\ No newline at end of file
@@ -0,0 +1,100 @@
+/**
+ * @file ThreadPool.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "ThreadPool.hpp"
+
+// constructor
+ThreadPool::ThreadPool(uint threadCount){
+    for(uint i=1; i<threadCount; i++){
+        threads.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+// destructor
+ThreadPool::~ThreadPool(){
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for(auto& thread : threads) thread.join();
+}
+
+// run tasks of current batch
+void ThreadPool::RunTasks(uint worker){
+    size_t task;
+    while((task = nextTask.fetch_add(1)) < taskCount){
+        (*function)(task, worker);
+    }
+}
+
+// wait for batches and run them
+void ThreadPool::WorkerLoop(uint worker){
+    uint64_t seen = 0;
+    while(true){
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&](){ return stopping || batch != seen; });
+            if(stopping) return;
+            seen = batch;
+        }
+
+        RunTasks(worker);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if(--busy == 0) done.notify_one();
+    }
+}
+
+// run batch of tasks
+void ThreadPool::Run(size_t taskCount, const TaskFunction& function){
+    if(taskCount == 0) return;
+
+    // not worth waking anyone for a single task
+    if(threads.empty() || taskCount == 1){
+        for(size_t task=0; task<taskCount; task++) function(task, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->function = &function;
+        this->taskCount = taskCount;
+        nextTask.store(0);
+        busy = static_cast<uint>(threads.size());
+        batch++;
+    }
+    wake.notify_all();
+
+    RunTasks(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&](){ return busy == 0; });
+    this->function = nullptr;
+}
\ No newline at end of file
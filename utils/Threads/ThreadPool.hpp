@@ -0,0 +1,102 @@
+/**
+ * @file ThreadPool.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_UTILS_THREADS_THREAD_POOL_HPP
+#define SIA_UTILS_THREADS_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef unsigned int uint;
+
+/**
+ * @brief fixed set of worker threads that run batches of tasks.
+ *        The thread calling Run works on the batch too, so a pool of
+ *        one thread runs everything on the calling thread.
+ */
+class ThreadPool{
+    // task function of batch being run
+    typedef std::function<void(size_t task, uint worker)> TaskFunction;
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    // signalled when a new batch is started or pool is stopping
+    std::condition_variable wake;
+    // signalled when last worker finishes a batch
+    std::condition_variable done;
+
+    const TaskFunction* function = nullptr;
+    size_t taskCount = 0;
+    std::atomic<size_t> nextTask{0};
+    // number of workers still running current batch
+    uint busy = 0;
+    // incremented for every batch so workers can tell batches apart
+    uint64_t batch = 0;
+    bool stopping = false;
+
+    // run tasks of current batch till none are left
+    void RunTasks(uint worker);
+    // body of every worker thread
+    void WorkerLoop(uint worker);
+public:
+    /**
+     * @brief Construct a new Thread Pool object
+     *
+     * @param threadCount number of threads including calling thread, at least 1
+     */
+    explicit ThreadPool(uint threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief call function once for every task in [0, taskCount) and wait for all of them.
+     *        Tasks are handed out in increasing order but may finish in any order.
+     *        worker is in [0, GetThreadCount()) and no two tasks with the same
+     *        worker run at the same time, so it can index per thread state.
+     *
+     * @param taskCount number of tasks
+     * @param function function to call for every task
+     */
+    void Run(size_t taskCount, const TaskFunction& function);
+
+    /// get number of threads including calling thread
+    uint GetThreadCount() const{
+        return static_cast<uint>(threads.size() + 1);
+    }
+};
+
+#endif//SIA_UTILS_THREADS_THREAD_POOL_HPP
\ No newline at end of file
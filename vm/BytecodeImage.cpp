@@ -0,0 +1,126 @@
+/**
+ * @file BytecodeImage.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "BytecodeImage.hpp"
+#include "Config.hpp"
+#include <Hash/Hash.hpp>
+#include <Loggers/Log.hpp>
+#include <cstdio>
+#include <cstring>
+
+// check that range [offset, offset + count * size) lies inside image and is aligned
+static bool InImage(uint64_t offset, uint64_t count, uint64_t size, uint64_t imageSize){
+    return offset % 8 == 0 && offset <= imageSize && count <= (imageSize - offset) / size;
+}
+
+// map and check image
+bool BytecodeImage::Open(const char* filename){
+    if(!file.Open(filename)){
+        LOG(ERROR, "failed to open bytecode image %s", filename)
+        return false;
+    }
+
+    if(file.GetSize() < sizeof(BytecodeHeader) || memcmp(file.GetData(), BytecodeMagic, sizeof(BytecodeMagic)) != 0){
+        LOG(ERROR, "%s is not a bytecode image", filename)
+        return false;
+    }
+
+    const BytecodeHeader& header = GetHeader();
+    char compilerVersion[sizeof(header.compilerVersion)] = {};
+    strncpy(compilerVersion, SIA_VERSION_NUMBER, sizeof(compilerVersion) - 1);
+    if(header.formatVersion != BytecodeFormatVersion || memcmp(header.compilerVersion, compilerVersion, sizeof(compilerVersion)) != 0){
+        LOG(ERROR, "%s was written by a different version of compiler, it must be rebuilt", filename)
+        return false;
+    }
+
+    if(header.imageSize != file.GetSize() || ChecksumBytes(file.GetData() + sizeof(BytecodeHeader), file.GetSize() - sizeof(BytecodeHeader)) != header.checksum){
+        LOG(ERROR, "%s failed checksum, it must be rebuilt", filename)
+        return false;
+    }
+
+    bool valid = InImage(header.constantsOffset, header.constantCount, sizeof(int64_t), header.imageSize)
+        && InImage(header.functionsOffset, header.functionCount, sizeof(BytecodeFunction), header.imageSize)
+        && InImage(header.codeOffset, header.codeCount, sizeof(BytecodeInstruction), header.imageSize)
+        && InImage(header.operandsOffset, header.operandCount, sizeof(uint32_t), header.imageSize)
+        && InImage(header.stringsOffset, header.stringsSize, 1, header.imageSize)
+        && (header.entryPoint == NoEntryPoint || header.entryPoint < header.functionCount);
+    if(!valid){
+        LOG(ERROR, "%s is corrupt, it must be rebuilt", filename)
+        return false;
+    }
+
+    return true;
+}
+
+// verify instructions of function
+bool BytecodeImage::VerifyFunction(uint32_t index) const{
+    const BytecodeHeader& header = GetHeader();
+    const BytecodeFunction* functions = GetFunctions();
+    const BytecodeInstruction* code = GetCode();
+    const uint32_t* operands = GetOperands();
+
+    const BytecodeFunction& function = functions[index];
+    if(function.nameOffset > header.stringsSize || function.nameLength > header.stringsSize - function.nameOffset) return false;
+    if(function.codeLength == 0 || function.codeOffset > header.codeCount || function.codeLength > header.codeCount - function.codeOffset) return false;
+    if(code[function.codeOffset + function.codeLength - 1].opcode != BytecodeOpcode::Return) return false;
+
+    // operands may only read parameters and registers written before them
+    for(uint32_t j=0; j<function.codeLength; j++){
+        const BytecodeInstruction& instruction = code[function.codeOffset + j];
+        uint32_t defined = function.parameterCount + j;
+        switch(instruction.opcode){
+            case BytecodeOpcode::LoadConstant :
+                if(instruction.a >= header.constantCount) return false;
+                break;
+            case BytecodeOpcode::LoadParameter :
+                if(instruction.a >= function.parameterCount) return false;
+                break;
+            case BytecodeOpcode::Add :
+            case BytecodeOpcode::Subtract :
+            case BytecodeOpcode::Multiply :
+            case BytecodeOpcode::Divide :
+                if(instruction.a >= defined || instruction.b >= defined) return false;
+                break;
+            case BytecodeOpcode::Negate :
+            case BytecodeOpcode::Return :
+                if(instruction.a >= defined) return false;
+                break;
+            case BytecodeOpcode::Call :
+                if(instruction.a >= header.functionCount || functions[instruction.a].parameterCount != instruction.b) return false;
+                if(instruction.c > header.operandCount || instruction.b > header.operandCount - instruction.c) return false;
+                for(uint32_t k=0; k<instruction.b; k++){
+                    if(operands[instruction.c + k] >= defined) return false;
+                }
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+/**
+ * @file BytecodeImage.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_VM_BYTECODE_IMAGE_HPP
+#define SIA_VM_BYTECODE_IMAGE_HPP
+
+#include <Bytecode/BytecodeFormat.hpp>
+#include <FileSystem/MappedFile.hpp>
+
+/**
+ * @brief bytecode image mapped for execution.
+ *        Sections are used in place, nothing is copied out of the mapping.
+ *        Only the header and section bounds are checked when an image is
+ *        opened, besides the checksum. Code of a function is verified by
+ *        VerifyFunction the first time it's called, so functions that
+ *        never run are never verified.
+ */
+class BytecodeImage{
+    MappedFile file;
+public:
+    /**
+     * @brief map image and check it.
+     *        Logs an error and fails if file is not an image, was written by a
+     *        different compiler version, fails checksum or has bad sections.
+     *
+     * @param filename name of image file
+     * @return true if image can be executed
+     */
+    bool Open(const char* filename);
+
+    /**
+     * @brief verify every instruction of a function so that interpreter
+     *        can trust its operands. Functions it calls are not verified.
+     *
+     * @param index index of function, must be less than functionCount
+     * @return true if function is well formed
+     */
+    bool VerifyFunction(uint32_t index) const;
+
+    const BytecodeHeader& GetHeader() const{
+        return *reinterpret_cast<const BytecodeHeader*>(file.GetData());
+    }
+
+    const int64_t* GetConstants() const{
+        return reinterpret_cast<const int64_t*>(file.GetData() + GetHeader().constantsOffset);
+    }
+
+    const BytecodeFunction* GetFunctions() const{
+        return reinterpret_cast<const BytecodeFunction*>(file.GetData() + GetHeader().functionsOffset);
+    }
+
+    const BytecodeInstruction* GetCode() const{
+        return reinterpret_cast<const BytecodeInstruction*>(file.GetData() + GetHeader().codeOffset);
+    }
+
+    const uint32_t* GetOperands() const{
+        return reinterpret_cast<const uint32_t*>(file.GetData() + GetHeader().operandsOffset);
+    }
+
+    const char* GetStrings() const{
+        return file.GetData() + GetHeader().stringsOffset;
+    }
+};
+
+#endif//SIA_VM_BYTECODE_IMAGE_HPP
\ No newline at end of file
@@ -0,0 +1,124 @@
+/**
+ * @file Interpreter.cpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "Interpreter.hpp"
+#include <Loggers/Log.hpp>
+#include <cstdio>
+
+// calls nested deeper than this are treated as infinite recursion
+static constexpr uint32_t MaxCallDepth = 10000;
+
+// verify function
+bool Interpreter::Verify(uint32_t function){
+    if(verified[function]) return true;
+    if(!image.VerifyFunction(function)){
+        LOG(ERROR, "function %u of bytecode image is corrupt, it must be rebuilt", function)
+        return false;
+    }
+    verified[function] = true;
+    return true;
+}
+
+// call function
+bool Interpreter::Run(uint32_t function, int64_t& result){
+    registers.clear();
+    depth = 0;
+    if(!Verify(function)) return false;
+    registers.resize(image.GetFunctions()[function].codeLength);
+    return Execute(function, 0, result);
+}
+
+// execute function
+bool Interpreter::Execute(uint32_t index, size_t frame, int64_t& result){
+    const BytecodeFunction& function = image.GetFunctions()[index];
+    const BytecodeInstruction* code = image.GetCode() + function.codeOffset;
+    const int64_t* constants = image.GetConstants();
+    const uint32_t* operands = image.GetOperands();
+
+    if(++depth > MaxCallDepth){
+        LOG(ERROR, "call stack overflow")
+        return false;
+    }
+
+    // arithmetic wraps around like two's complement integers
+    for(uint32_t i=0; ; i++){
+        const BytecodeInstruction& instruction = code[i];
+        size_t target = frame + function.parameterCount + i;
+        switch(instruction.opcode){
+            case BytecodeOpcode::LoadConstant :
+                registers[target] = constants[instruction.a];
+                break;
+            case BytecodeOpcode::LoadParameter :
+                registers[target] = registers[frame + instruction.a];
+                break;
+            case BytecodeOpcode::Add :
+                registers[target] = static_cast<int64_t>(uint64_t(registers[frame + instruction.a]) + uint64_t(registers[frame + instruction.b]));
+                break;
+            case BytecodeOpcode::Subtract :
+                registers[target] = static_cast<int64_t>(uint64_t(registers[frame + instruction.a]) - uint64_t(registers[frame + instruction.b]));
+                break;
+            case BytecodeOpcode::Multiply :
+                registers[target] = static_cast<int64_t>(uint64_t(registers[frame + instruction.a]) * uint64_t(registers[frame + instruction.b]));
+                break;
+            case BytecodeOpcode::Divide :{
+                int64_t lhs = registers[frame + instruction.a];
+                int64_t rhs = registers[frame + instruction.b];
+                if(rhs == 0){
+                    LOG(ERROR, "division by zero")
+                    return false;
+                }
+                registers[target] = (rhs == -1) ? static_cast<int64_t>(0 - uint64_t(lhs)) : lhs / rhs;
+                break;
+            }
+            case BytecodeOpcode::Negate :
+                registers[target] = static_cast<int64_t>(0 - uint64_t(registers[frame + instruction.a]));
+                break;
+            case BytecodeOpcode::Call :{
+                // callee frame starts with its arguments
+                if(!Verify(instruction.a)) return false;
+                const BytecodeFunction& callee = image.GetFunctions()[instruction.a];
+                size_t calleeFrame = registers.size();
+                registers.resize(calleeFrame + callee.parameterCount + callee.codeLength);
+                for(uint32_t j=0; j<instruction.b; j++){
+                    registers[calleeFrame + j] = registers[frame + operands[instruction.c + j]];
+                }
+
+                int64_t value;
+                if(!Execute(instruction.a, calleeFrame, value)) return false;
+                registers.resize(calleeFrame);
+                registers[target] = value;
+                break;
+            }
+            case BytecodeOpcode::Return :
+                result = registers[frame + instruction.a];
+                depth--;
+                return true;
+        }
+    }
+}
\ No newline at end of file
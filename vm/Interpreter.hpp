@@ -0,0 +1,71 @@
+/**
+ * @file Interpreter.hpp
+ * @author Siddharth Mishra
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021 Siddharth Mishra
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef SIA_VM_INTERPRETER_HPP
+#define SIA_VM_INTERPRETER_HPP
+
+#include "BytecodeImage.hpp"
+#include <vector>
+
+/**
+ * @brief executes functions of a bytecode image.
+ *        Registers of all active calls live on one register stack.
+ *        Every function is verified right before its first call.
+ */
+class Interpreter{
+    const BytecodeImage& image;
+    // registers of all active calls
+    std::vector<int64_t> registers;
+    // number of active calls
+    uint32_t depth = 0;
+    // functions that were verified already
+    std::vector<bool> verified;
+
+    // verify function if it wasn't verified yet
+    bool Verify(uint32_t function);
+
+    // execute function whose registers start at frame
+    bool Execute(uint32_t function, size_t frame, int64_t& result);
+public:
+    explicit Interpreter(const BytecodeImage& image)
+    : image(image), verified(image.GetHeader().functionCount, false){}
+
+    /**
+     * @brief call function without arguments.
+     *        Logs an error and fails on runtime errors like division by zero
+     *        and when a function that is about to be called is corrupt.
+     *
+     * @param function index of function in image
+     * @param result value returned by function
+     * @return true if function returned normally
+     */
+    bool Run(uint32_t function, int64_t& result);
+};
+
+#endif//SIA_VM_INTERPRETER_HPP
\ No newline at end of file
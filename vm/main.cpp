@@ -0,0 +1,64 @@
+#include "Config.hpp"
+#include "BytecodeImage.hpp"
+#include "Interpreter.hpp"
+#include <CommandLine/ArgumentParser.hpp>
+#include <Loggers/Log.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char** argv){
+    // startup is measured from here to first executed instruction
+    auto launch = std::chrono::steady_clock::now();
+
+    // create an argument parser for parsing command line arguments
+    ArgumentParser cmdLineParser;
+
+    // add options to check for
+    cmdLineParser.AddOption(OptionDescription("image", "bytecode image to execute", ValueType::String, 1));
+    cmdLineParser.AddOption(OptionDescription("timing", "print time taken to start and to execute image", ValueType::Bool, 1));
+
+    // need atleast 3 arguments
+    cmdLineParser.SetMinimumArgumentCount(3);
+
+    // parse arguments
+    cmdLineParser.ParseArguments(argc, argv);
+
+    bool timing = false;
+    Option* timingOption = cmdLineParser.GetOption("timing");
+    if(timingOption) timingOption->GetNextValue(&timing);
+
+    Option* imageOption = cmdLineParser.GetOption("image");
+    if(!imageOption){
+        LOG(ERROR, "no bytecode image was provided to execute")
+        std::quick_exit(-1);
+    }
+    const char* filename;
+    imageOption->GetNextValue(&filename);
+
+    BytecodeImage image;
+    if(!image.Open(filename)){
+        fflush(stdout);
+        std::quick_exit(-1);
+    }
+    if(image.GetHeader().entryPoint == NoEntryPoint){
+        LOG(ERROR, "%s has no main function to execute", filename)
+        fflush(stdout);
+        std::quick_exit(-1);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    Interpreter interpreter(image);
+    int64_t result;
+    bool success = interpreter.Run(image.GetHeader().entryPoint, result);
+    auto end = std::chrono::steady_clock::now();
+
+    if(success) printf("%lld\n", static_cast<long long>(result));
+    if(timing){
+        LOG(TIMING, "startup : %lld us, execution : %lld us",
+            static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(start - launch).count()),
+            static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()))
+    }
+    fflush(stdout);
+    if(!success) std::quick_exit(-1);
+}
\ No newline at end of file